@@ -44,6 +44,8 @@ class FieldFace;
 #include "data_ItFieldList.hpp"
 #include "data_ItFieldRange.hpp"
 #include "data_FieldDescr.hpp"
+#include "data_FieldHandle.hpp"
+#include "data_FieldView.hpp"
 #include "data_FieldData.hpp"
 #include "data_FieldFace.hpp"
 #include "data_Field.hpp"
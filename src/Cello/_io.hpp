@@ -43,6 +43,7 @@ enum meta_type {
 #include "io_OutputImage.hpp"
 #include "io_OutputData.hpp"
 #include "io_OutputCheckpoint.hpp"
+#include "io_OutputAnalysis.hpp"
 
 #include "io_Schedule.hpp"
 #include "io_ScheduleList.hpp"
@@ -113,6 +113,7 @@ enum refresh_type {
 class Tree;
 
 #include "mesh_Index.hpp"
+#include "mesh_Neighbor.hpp"
 
 #include "mesh_Block.hpp"
 #include "mesh_Hierarchy.hpp"
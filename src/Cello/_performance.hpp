@@ -22,6 +22,9 @@
 #ifdef __linux__
 #   include <unistd.h>
 #endif
+
+#include "pup_stl.h"
+
 #ifdef CONFIG_USE_PAPI
 #  include "papi.h"
 #endif
@@ -34,6 +37,7 @@
 #include "performance_PerfCounters.hpp"
 #include "performance_Papi.hpp"
 #include "performance_Performance.hpp"
+#include "performance_Trace.hpp"
 
 
 #endif /* _PERFORMANCE_HPP */
@@ -32,6 +32,7 @@ enum neighbor_enum {
 // System includes
 //----------------------------------------------------------------------
 
+#include <map>
 #include <string>
 #include <vector>
 #include <limits>
@@ -60,6 +61,7 @@ enum neighbor_enum {
 #include "problem_BoundaryValue.hpp"
 #include "problem_BoundaryPeriodic.hpp"
 #include "problem_Method.hpp"
+#include "problem_Reduction.hpp"
 #include "problem_Prolong.hpp"
 #include "problem_ProlongLinear.hpp"
 #include "problem_Restrict.hpp"
@@ -69,14 +69,15 @@ enum axis_enum {
 typedef int axis_type;
 
 /// @enum     reduce_enum
-/// @brief    Reduction operator, used for image projections
+/// @brief    Reduction operator, used for image projections and Reduction
 enum reduce_enum {
   reduce_unknown, /// Unknown reduction
   reduce_min,     /// Minimal value along the axis
   reduce_max,     /// Maximal value along the axis
   reduce_avg,     /// Average value along the axis
   reduce_sum,     /// Sum of values along the axis
-  reduce_set      /// Value of last processed (used for mesh plotting)
+  reduce_set,     /// Value of last processed (used for mesh plotting)
+  reduce_sum_kahan /// Sum of values with compensation for rounding error
 };
 typedef int reduce_type;
 
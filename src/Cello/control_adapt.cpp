@@ -178,7 +178,16 @@ void Block::adapt_end_()
 
   bool adapt_again = (is_first_cycle && (adapt_step_++ < level_maximum));
 
-  if (adapt_again) {
+  if (adapt_again && adapt_initial_direct_()) {
+
+    // Let the Simulation group decide whether any Block refined
+
+    if (index_.is_root()) {
+      CkStartQD (CkCallback(CkIndex_Simulation::p_adapt_initial_count(),
+			    proxy_simulation));
+    }
+
+  } else if (adapt_again) {
     control_sync (CkIndex_Main::p_adapt_enter(),sync_quiescence);
   } else {
     control_sync (CkIndex_Main::p_adapt_exit(),sync_quiescence);
@@ -193,8 +202,27 @@ bool Block::do_adapt_()
 
   int adapt_interval = simulation()->config()->mesh_adapt_interval;
 
-  return ((adapt_interval && ((cycle_ % adapt_interval) == 0)));
+  // With Adapt:subcycle, only adapt when all levels are at the same time
+
+  return ((adapt_interval && ((cycle_ % adapt_interval) == 0)) &&
+	  subcycle_synchronized_());
+
+}
+
+//----------------------------------------------------------------------
+
+/// @brief Return whether the initial mesh is being refined with
+/// Adapt:initial_direct
+///
+/// Blocks created while refining the initial mesh apply the Initial
+/// conditions in their constructor, so they are created without
+/// prolonged data from their parent.
+bool Block::adapt_initial_direct_() const
+{
+  const Config * config = simulation()->config();
 
+  return (config->adapt_initial_direct &&
+	  config->initial_cycle == cycle_);
 }
 
 //----------------------------------------------------------------------
@@ -227,6 +255,11 @@ int Block::adapt_compute_desired_level_(int level_maximum)
   int index_refine = 0;
   while ((refine = problem->refine(index_refine++))) {
 
+    // Once refinement is certain, remaining criteria are only
+    // evaluated to fill in their output fields
+
+    if (adapt_ == adapt_refine && refine->output() == "") continue;
+
     adapt_ = std::max(adapt_,refine->apply(this, field_descr));
 
   }
@@ -266,6 +299,15 @@ void Block::adapt_refine_()
 
   adapt_ = adapt_unknown;
 
+  // Non-leaf Blocks do not enforce boundary conditions
+
+  invalidate_boundary_();
+
+  if (simulation()->config()->adapt_refine_bulk) {
+    adapt_refine_bulk_();
+    return;
+  }
+
   const int rank = this->rank();
   
   int nx,ny,nz;
@@ -273,6 +315,10 @@ void Block::adapt_refine_()
 
   std::vector<int> field_list;
 
+  const bool initial_direct = adapt_initial_direct_();
+
+  if (initial_direct) simulation()->increment_refine_count();
+
   // For each new child
 
   ItChild it_child (rank);
@@ -285,14 +331,14 @@ void Block::adapt_refine_()
 
     if ( ! is_child_(index_child) ) {
 
-      // Prolong data
+      // Prolong data, unless the child will apply Initial conditions
 
       int narray = 0;  
       char * array = 0;
       int iface[3] = {0,0,0};
       bool lghost[3] = {true,true,true};
       
-      FieldFace * field_face = 
+      FieldFace * field_face = initial_direct ? NULL :
 	load_face (&narray,&array, iface,ic3,lghost, op_array_prolong,
 		    field_list);
 
@@ -329,6 +375,90 @@ void Block::adapt_refine_()
 
 //----------------------------------------------------------------------
 
+/// @brief Insert all children of a refining Block in a single pass
+///
+/// Unlike the default path in adapt_refine_(), a single FieldFace and
+/// send buffer are shared by all children: the coarse octant for each
+/// child is loaded into the same buffer, which Charm++ copies when
+/// marshalling the insert() call, so the buffer can be reused by the
+/// next child.  Prolongation is still performed by each child from
+/// its coarse octant when the child stores the array.  Children do
+/// not call doneInserting() themselves; instead all Blocks inserted
+/// during this adapt step share the single doneInserting() epoch
+/// closed by the root Block in adapt_end_().
+
+void Block::adapt_refine_bulk_()
+{
+  const int rank = this->rank();
+
+  int nx,ny,nz;
+  data()->field_data()->size(&nx,&ny,&nz);
+
+  const Factory * factory = simulation()->factory();
+
+  const int num_field_data = 1;
+  const bool testing = false;
+
+  const bool initial_direct = adapt_initial_direct_();
+
+  if (initial_direct) simulation()->increment_refine_count();
+
+  // Shared FieldFace: field list and send buffer are initialized
+  // once, and not at all if children will apply Initial conditions
+
+  int ic3[3] = {0,0,0};
+  int iface[3] = {0,0,0};
+  bool lghost[3] = {true,true,true};
+  std::vector<int> field_list;
+
+  FieldFace * field_face = initial_direct ? NULL :
+    create_face_ (iface,ic3,lghost, op_array_prolong, field_list);
+
+  Prolong * prolong = simulation()->problem()->prolong();
+
+  ItChild it_child (rank);
+  while (it_child.next(ic3)) {
+
+    Index index_child = index_.index_child(ic3);
+
+    if ( ! is_child_(index_child) ) {
+
+      // Load this child's coarse octant into the shared buffer
+
+      int narray = 0;  
+      char * array = 0;
+
+      if (field_face) {
+	field_face->set_prolong(prolong,ic3[0],ic3[1],ic3[2]);
+	field_face->load(&narray,&array);
+      }
+
+      factory->create_block 
+	(&thisProxy, index_child,
+	 nx,ny,nz,
+	 num_field_data,
+	 adapt_step_,
+	 cycle_,time_,dt_,
+	 narray, array, op_array_prolong,
+	 27,&child_face_level_curr_[27*IC3(ic3)],
+	 testing,
+	 simulation());
+
+      children_.push_back(index_child);
+
+    }
+  }
+
+  delete field_face;
+
+  is_leaf_ = false;
+#ifdef DEBUG_ADAPT
+  index_.print("adapt_refine_bulk leaf=0",-1,2,false,simulation());
+#endif
+}
+
+//----------------------------------------------------------------------
+
 void Block::adapt_delete_child_(Index index_child)
 {
 #ifdef DEBUG_ADAPT
@@ -350,14 +480,14 @@ void Block::adapt_send_level()
   const int level = this->level();
   const int min_face_rank = 
     simulation()->config()->adapt_min_face_rank;
-  ItNeighbor it_neighbor = this->it_neighbor(min_face_rank,index_);
-  int of3[3];
-
-  while (it_neighbor.next()) {
-    Index index_neighbor = it_neighbor.index();
-    int ic3[3];
-    it_neighbor.child(ic3);
-    it_neighbor.face(of3);
+  const std::vector<Neighbor> & neighbor_list = this->neighbor_list();
+
+  for (size_t i=0; i<neighbor_list.size(); i++) {
+    const Neighbor & neighbor = neighbor_list[i];
+    if (neighbor.face_rank < min_face_rank) continue;
+    Index index_neighbor = neighbor.index;
+    int ic3[3] = {neighbor.child[0],neighbor.child[1],neighbor.child[2]};
+    int of3[3] = {neighbor.face[0], neighbor.face[1], neighbor.face[2]};
     PUT_LEVEL (index_,index_neighbor,ic3,of3,level,level_next_,"send");
   }
 }
@@ -770,3 +900,40 @@ bool Block::parent_face_
   return retval;
 }
 
+
+//----------------------------------------------------------------------
+
+/// @brief Sum the number of Blocks refined in the last initial adapt
+/// step over all processes
+///
+/// Called on all Simulation objects at quiescence after adapt_end_()
+/// when refining the initial mesh with Adapt:initial_direct.
+void Simulation::p_adapt_initial_count()
+{
+  const int count = refine_count_;
+
+  refine_count_ = 0;
+
+  CkCallback callback
+    (CkIndex_Simulation::r_adapt_initial_count(NULL), thisProxy[0]);
+
+  contribute(sizeof(int),&count,CkReduction::sum_int,callback);
+}
+
+//----------------------------------------------------------------------
+
+/// @brief Start another initial adapt step only if the last one
+/// refined any Block, since otherwise the mesh has reached the
+/// levels required by the Refine criteria
+void Simulation::r_adapt_initial_count(CkReductionMsg * msg)
+{
+  const int count = ((int *)msg->getData())[0];
+
+  delete msg;
+
+  if (count > 0) {
+    hierarchy()->block_array()->p_adapt_enter();
+  } else {
+    hierarchy()->block_array()->p_adapt_exit();
+  }
+}
@@ -110,6 +110,10 @@ void Block::stopping_exit_()
 
   if (stop_) {
 
+    // Write remaining trace events before any process exits
+
+    simulation()->trace_flush();
+
     control_sync(CkIndex_Block::r_exit(NULL),sync_barrier);
 
   } else {
@@ -145,7 +149,13 @@ void Block::compute_exit_ ()
 void Block::refresh_enter_(int callback, Refresh * refresh) 
 {
   TRACE_CONTROL("refresh_enter");
-  performance_switch_(perf_refresh,__FILE__,__LINE__);
+
+  // Attribute refreshes issued by a Method to that Method's region
+
+  const int index_region = method() ?
+    simulation()->performance_region_refresh(index_method_) : perf_refresh;
+
+  performance_switch_(index_region,__FILE__,__LINE__);
 
   set_refresh(refresh);
 
@@ -205,17 +215,13 @@ void Block::control_sync_neighbor_(int entry_point, int phase)
     return;
   }
 
-  const int min_face_rank = 0;
-
-  int num_neighbors = 0;
-
-  ItNeighbor it_neighbor = this->it_neighbor(min_face_rank,index_);
+  const std::vector<Neighbor> & neighbor_list = this->neighbor_list();
 
-  while (it_neighbor.next()) {
+  const int num_neighbors = neighbor_list.size();
 
-    ++num_neighbors;
+  for (int i=0; i<num_neighbors; i++) {
 
-    Index index_neighbor = it_neighbor.index();
+    Index index_neighbor = neighbor_list[i].index;
 
     thisProxy[index_neighbor].p_control_sync_count(entry_point,phase);
 
@@ -21,6 +21,16 @@ void Block::compute_begin_ ()
   TRACE("Block::compute_begin()");
   simulation()->set_phase(phase_compute);
 
+  reset_cost();
+
+  // With Adapt:subcycle, Blocks that compute this cycle take a
+  // timestep spanning all cycles until their next step
+
+  const int period = subcycle_period_();
+  if (period > 1 && subcycle_active_()) {
+    set_dt (dt_ * period);
+  }
+
   index_method_ = 0;
   compute_next_();
 }
@@ -62,15 +72,81 @@ void Block::compute_continue_ ()
   TRACE2 ("Block::compute_continue() method = %d %p\n",
 	  index_method_,method); fflush(stdout);
 
-  // Apply the method to the Block
+  performance_switch_(perf_compute,__FILE__,__LINE__);
+
+  if (! subcycle_active_()) {
+
+    // Skip Methods until this Block's next subcycle step
+
+    compute_done();
+    return;
+  }
+
+  if (index_method_ == 0 && subcycle_period_() > 1) {
+    subcycle_save_old_();
+  }
+
+  // Apply the method to the Block, timing the synchronous part (or
+  // until compute_done() if called first) in the Method's region
+
+  time_method_start_ = simulation()->performance()->time_usec();
+
   method -> compute (this);
 
+  compute_cost_();
+
+}
+
+//----------------------------------------------------------------------
+
+void Block::compute_cost_ ()
+{
+  if (time_method_start_ == 0) return;
+
+  Performance * performance = simulation()->performance();
+
+  long long time = performance->time_usec() - time_method_start_;
+
+  const int index_region =
+    simulation()->performance_region_method(index_method_);
+
+  Trace * trace = simulation()->trace();
+  if (trace && trace_thread_ >= 0) {
+    trace->record (index_region,trace_thread_,time_method_start_,time);
+  }
+
+  time_method_start_ = 0;
+
+  if ((int)method_cost_.size() <= index_method_) {
+    method_cost_.resize(index_method_+1,0);
+  }
+  method_cost_[index_method_] += time;
+
+  performance->increment_region_counter (index_region, index_time_, time);
+}
+
+//----------------------------------------------------------------------
+
+long long Block::cost (int index_method) const throw()
+{
+  if (index_method >= 0) {
+    return (index_method < (int)method_cost_.size()) ?
+      method_cost_[index_method] : 0;
+  } else {
+    long long cost = 0;
+    for (size_t i=0; i<method_cost_.size(); i++) {
+      cost += method_cost_[i];
+    }
+    return cost;
+  }
 }
 
 //----------------------------------------------------------------------
 
 void Block::compute_done ()
 {
+  compute_cost_();
+
   index_method_++;
   compute_next_();
 }
@@ -84,6 +160,11 @@ void Block::compute_end_ ()
   //  traceUserBracketEvent(10,time_start, CmiWallTimer());
 #endif
 
+  const int period = subcycle_period_();
+  if (period > 1 && subcycle_active_()) {
+    set_dt (dt_ / period);
+  }
+
   set_cycle (cycle_ + 1);
   set_time  (time_  + dt_);
   simulation()->set_cycle(cycle_);
@@ -36,6 +36,7 @@ void Simulation::initialize() throw()
   problem_->initialize_stopping(config_);
   problem_->initialize_output  (config_,field_descr_,factory());
   problem_->initialize_method  (config_,field_descr_);
+  initialize_performance_methods_();
   problem_->initialize_prolong (config_);
   problem_->initialize_restrict (config_);
 
@@ -64,6 +65,14 @@ void Simulation::r_initialize_forest(CkReductionMsg * msg)
   
   initialize_forest_();
 
+  if (config_->mesh_distributed_insert) {
+    // Send the new Block array to all processes to insert their Blocks
+    if (CkMyPe() == 0) {
+      thisProxy.p_initialize_forest_local(*hierarchy_->block_array());
+    }
+    return;
+  }
+
   // --------------------------------------------------
   // ENTRY: #2 Simulation::r_initialize_forest() -> Simulation::r_initialize_hierarchy()
   // ENTRY: callback   
@@ -77,10 +86,30 @@ void Simulation::r_initialize_forest(CkReductionMsg * msg)
 
 //----------------------------------------------------------------------
 
+void Simulation::p_initialize_forest_local(CProxy_Block block_array)
+{
+  if (CkMyPe() != 0) hierarchy_->set_block_array(block_array);
+
+  // Insert root and sub-root Blocks mapped to this process
+
+  hierarchy_->insert_forest_local(config_->mesh_min_level);
+
+  CkCallback callback 
+    (CkIndex_Simulation::r_initialize_hierarchy(NULL), thisProxy);
+
+  contribute(0,0,CkReduction::concat,callback);
+}
+
+//----------------------------------------------------------------------
+
 void Simulation::r_initialize_hierarchy(CkReductionMsg * msg) 
 {
   delete msg;
   if (CkMyPe() == 0) {
+
+    if (config_->mesh_distributed_insert) {
+      hierarchy()->block_array()->doneInserting();
+    }
     
     // --------------------------------------------------
     // ENTRY: #3 Simulation::r_initialize_hierarchy() -> Block::p_adapt_mesh()
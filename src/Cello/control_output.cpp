@@ -34,15 +34,21 @@ void Block::output_begin_ ()
   int cycle   = simulation()->cycle();
   double time = simulation()->time();
 
-  Output * output;
+  Output * output = NULL;
 
   int index_output = -1;
 
-  do {
+  // With Adapt:subcycle, only output when all levels are at the same time
 
-    output = simulation()->problem()->output(++index_output);
+  if (subcycle_synchronized_()) {
 
-  } while (output && ! output->is_scheduled(cycle, time));
+    do {
+
+      output = simulation()->problem()->output(++index_output);
+
+    } while (output && ! output->is_scheduled(cycle, time));
+
+  }
 
   if (output != NULL) {
 
@@ -42,14 +42,18 @@ void Block::refresh_begin_()
     const int level = this->level();
 
     if (refresh->neighbor_type() == neighbor_leaf) {
-      ItNeighbor it_neighbor = this->it_neighbor(min_face_rank,index_);
+      const std::vector<Neighbor> & neighbor_list = this->neighbor_list();
       int if3[3];
       int ic3[3];
-      while (it_neighbor.next()) {
-	Index index_neighbor = it_neighbor.index();
-	it_neighbor.face(if3);
-	it_neighbor.child(ic3);
-	int level_face = it_neighbor.face_level();
+      for (size_t i=0; i<neighbor_list.size(); i++) {
+	const Neighbor & neighbor = neighbor_list[i];
+	if (neighbor.face_rank < min_face_rank) continue;
+	Index index_neighbor = neighbor.index;
+	for (int axis=0; axis<3; axis++) {
+	  if3[axis] = neighbor.face[axis];
+	  ic3[axis] = neighbor.child[axis];
+	}
+	int level_face = neighbor.face_level;
 	++count;
 
 	if (level_face == level) {
@@ -138,15 +142,48 @@ void Block::refresh_load_face_
 
     std::vector<int> field_list = refresh->field_list();
 
+    // With Adapt:subcycle, finer neighbors may need the fields
+    // interpolated to an intermediate time of this Block's timestep
+
+    FieldData * field_data = (type_refresh == refresh_fine) ?
+      subcycle_field_data_() : NULL;
+
     field_face = load_face (&n, &array,
 			    iface, ichild, lghost,
 			    type_op_array,
-			    field_list);
+			    field_list,
+			    field_data);
 
     int jface[3] = {-iface[0], -iface[1], -iface[2]};
 
-    thisProxy[index_neighbor].p_refresh_store_face
-      (n,array, type_refresh, jface, ichild);
+    // Fluxes across a face shared with a coarser neighbor are sent
+    // after the restricted field data for flux correction
+
+    int n_flux = 0;
+    char * array_flux = 0;
+
+    const bool is_face =
+      (abs(iface[0]) + abs(iface[1]) + abs(iface[2]) == 1);
+
+    if (type_refresh == refresh_coarse && is_face) {
+      load_flux_face (&n_flux, &array_flux, iface);
+    }
+
+    if (n_flux == 0) {
+
+      thisProxy[index_neighbor].p_refresh_store_face
+	(n,array, type_refresh, jface, ichild);
+
+    } else {
+
+      std::vector<char> buffer (n + n_flux);
+      memcpy (&buffer[0],   array,      n);
+      memcpy (&buffer[n],   array_flux, n_flux);
+
+      thisProxy[index_neighbor].p_refresh_store_face
+	(n + n_flux, &buffer[0], type_refresh, jface, ichild);
+
+    }
 
     delete field_face;
   }
@@ -183,10 +220,31 @@ void Block::refresh_store_face_
       break;
     }
 
-    store_face_(n,buffer,
-		iface, ichild, lghost,
-		op_array,
-		field_list);
+    if (type_refresh == refresh_coarse) {
+
+      // Any bytes following the field data are fluxes for correcting
+      // this Block's fluxes across the face
+
+      FieldFace * field_face = create_face_
+	(iface, ichild, lghost, op_array, field_list);
+
+      field_face->store(n, buffer);
+
+      const int n_field = field_face->size();
+
+      delete field_face;
+
+      if (n > n_field) {
+	store_flux_face (n - n_field, buffer + n_field, iface, ichild);
+      }
+
+    } else {
+
+      store_face_(n,buffer,
+		  iface, ichild, lghost,
+		  op_array,
+		  field_list);
+    }
   }
 }
 
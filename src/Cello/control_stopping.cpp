@@ -45,10 +45,23 @@ void Block::stopping_begin_()
 
   int stopping_interval = simulation->config()->stopping_interval;
 
+  const bool subcycle = simulation->config()->adapt_subcycle;
+
+  // With Adapt:subcycle, timesteps can only change when all levels
+  // are at the same time
+
   bool stopping_reduce = stopping_interval ? 
     ((cycle_ % stopping_interval) == 0) : false;
 
-  if (stopping_reduce || dt_==0.0) {
+  if (subcycle) {
+    stopping_reduce = stopping_interval ? subcycle_synchronized_() : false;
+  }
+
+  if (subcycle && (stopping_reduce || dt_==0.0)) {
+
+    stopping_subcycle_();
+
+  } else if (stopping_reduce || dt_==0.0) {
 
     // Compute local dt
 
@@ -111,13 +124,44 @@ void Block::r_stopping_compute_timestep(CkReductionMsg * msg)
 
   double * min_reduce = (double * )msg->getData();
 
-  dt_   = min_reduce[0];
+  Simulation * simulation = proxy_simulation.ckLocalBranch();
+
+  if (msg->getSize() == 4*sizeof(double)) {
+
+    // Adapt:subcycle: min_reduce[0] is the timestep scaled to level 0
+
+    subcycle_level_min_ =   int(min_reduce[2]);
+    subcycle_level_max_ = - int(min_reduce[3]);
+    subcycle_cycle_     =   cycle_;
+
+    double dt_sync = ldexp(min_reduce[0],-subcycle_level_min_);
+
+    Problem * problem = simulation->problem();
+
+    int index_output=0;
+    while (Output * output = problem->output(index_output++)) {
+      Schedule * schedule = output->schedule();
+      dt_sync = schedule->update_timestep(time_,dt_sync);
+    }
+
+    double time_stop = problem->stopping()->stop_time();
+
+    dt_sync = MIN (dt_sync, (time_stop - time_));
+
+    // Timestep of the finest level
+
+    dt_ = ldexp(dt_sync,-(subcycle_level_max_ - subcycle_level_min_));
+
+  } else {
+
+    dt_   = min_reduce[0];
+
+  }
+
   stop_ = min_reduce[1] == 1.0 ? true : false;
 
   delete msg;
 
-  Simulation * simulation = proxy_simulation.ckLocalBranch();
-
   set_dt   (dt_);
   set_stop (stop_);
 
@@ -164,6 +208,48 @@ void Block::r_stopping_compute_timestep(CkReductionMsg * msg)
 
 //----------------------------------------------------------------------
 
+void Block::stopping_subcycle_()
+{
+  // Reduce the timestep scaled to level 0, stopping criteria, and
+  // the minimum and maximum leaf levels; non-leaf Blocks only
+  // contribute to the stopping criteria
+
+  Problem * problem = simulation()->problem();
+
+  const int level = this->level();
+
+  double min_reduce[4];
+
+  min_reduce[0] = std::numeric_limits<double>::max();
+  min_reduce[2] = std::numeric_limits<double>::max();
+  min_reduce[3] = std::numeric_limits<double>::max();
+
+  if (is_leaf()) {
+
+    int index = 0;
+    Method * method;
+    double dt_block = std::numeric_limits<double>::max();
+    while ((method = problem->method(index++))) {
+      dt_block = std::min(dt_block,method->timestep(this));
+    }
+
+    min_reduce[0] = std::min(ldexp(dt_block,level),min_reduce[0]);
+    min_reduce[2] =   level;
+    min_reduce[3] = - level;
+  }
+
+  int stop_block = problem->stopping()->complete(cycle_,time_);
+
+  min_reduce[1] = stop_block ? 1.0 : 0.0;
+
+  CkCallback callback (CkIndex_Block::r_stopping_compute_timestep(NULL),
+		       thisProxy);
+
+  contribute(4*sizeof(double), min_reduce, CkReduction::min_double, callback);
+}
+
+//----------------------------------------------------------------------
+
 void Block::stopping_balance_()
 {
 
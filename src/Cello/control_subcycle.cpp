@@ -0,0 +1,138 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     control_subcycle.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Functions for level subcycling with Adapt:subcycle
+/// @ingroup  Control
+///
+///    With Adapt:subcycle, a cycle advances the finest leaf level by
+///    one timestep dt_, and leaf Blocks in level L compute only every
+///    2^(level_max - L) cycles with a correspondingly larger
+///    timestep.  Between their steps, coarse Blocks send ghost data to
+///    finer neighbors linearly interpolated in time between the fields
+///    saved at the start of the step and the updated fields.
+
+#include "simulation.hpp"
+#include "mesh.hpp"
+#include "control.hpp"
+
+#include "charm_simulation.hpp"
+#include "charm_mesh.hpp"
+
+//----------------------------------------------------------------------
+
+int Block::subcycle_period_() const
+{
+  const int levels = subcycle_level_max_ - level();
+  return (is_leaf() && levels > 0) ? (1 << levels) : 1;
+}
+
+//----------------------------------------------------------------------
+
+void Block::subcycle_save_old_()
+{
+  // Only needed if some face neighbor is finer
+
+  bool need_old = false;
+  const int level = this->level();
+  for (size_t i=0; i<face_level_curr_.size(); i++) {
+    if (face_level_curr_[i] > level) need_old = true;
+  }
+
+  if (field_data_interp_) delete field_data_interp_;
+  field_data_interp_ = NULL;
+  cycle_interp_ = -1;
+
+  if (! need_old) {
+    if (field_data_old_) delete field_data_old_;
+    field_data_old_ = NULL;
+    return;
+  }
+
+  FieldData * field_data = data()->field_data();
+
+  if (field_data_old_ == NULL) {
+    int nx,ny,nz;
+    field_data->size(&nx,&ny,&nz);
+    field_data_old_ = new FieldData (simulation()->field_descr(),nx,ny,nz);
+    field_data_old_->allocate_permanent(field_data->ghosts_allocated());
+  }
+
+  for (int id=0; id<field_data->field_count(); id++) {
+    if (field_data->is_permanent(id)) {
+      memcpy (field_data_old_->values(id),
+	      field_data->values(id),
+	      field_data->field_size(id));
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Set values = old + a*(values - old)
+
+template <class T>
+static void interpolate_ (T * values, const T * values_old, int n, double a)
+{
+  for (int i=0; i<n; i++) {
+    values[i] = values_old[i] + a*(values[i] - values_old[i]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+FieldData * Block::subcycle_field_data_()
+{
+  if (field_data_old_ == NULL || subcycle_active_()) return NULL;
+
+  if (cycle_interp_ == cycle_) return field_data_interp_;
+
+  FieldData * field_data = data()->field_data();
+
+  if (field_data_interp_ == NULL) {
+    int nx,ny,nz;
+    field_data->size(&nx,&ny,&nz);
+    field_data_interp_ = new FieldData (simulation()->field_descr(),nx,ny,nz);
+    field_data_interp_->allocate_permanent(field_data->ghosts_allocated());
+  }
+
+  const int period = subcycle_period_();
+  const double a = double((cycle_ - subcycle_cycle_) % period) / period;
+
+  for (int id=0; id<field_data->field_count(); id++) {
+
+    if (! field_data->is_permanent(id)) continue;
+
+    char *       values     = field_data_interp_->values(id);
+    const char * values_old = field_data_old_->values(id);
+
+    const int bytes = field_data->field_size(id);
+
+    memcpy (values, field_data->values(id), bytes);
+
+    switch (field_data->precision(id)) {
+    case precision_single:
+      interpolate_ ((float *)values, (const float *)values_old,
+		    bytes/sizeof(float), a);
+      break;
+    case precision_double:
+      interpolate_ ((double *)values, (const double *)values_old,
+		    bytes/sizeof(double), a);
+      break;
+    case precision_extended80:
+    case precision_extended96:
+    case precision_quadruple:
+      interpolate_ ((long double *)values, (const long double *)values_old,
+		    bytes/sizeof(long double), a);
+      break;
+    default:
+      ERROR1 ("Block::subcycle_field_data_()",
+	      "Unsupported precision %d",field_data->precision(id));
+    }
+  }
+
+  cycle_interp_ = cycle_;
+
+  return field_data_interp_;
+}
@@ -204,6 +204,24 @@ public: // interface
   const char * unknowns (std::string name) const throw (std::out_of_range)
   { return field_data_->unknowns(name); }
 
+  /// Return a typed view of the field referred to by the handle,
+  /// which is empty if the handle is undefined
+  template <class T>
+  FieldView<T> view (const FieldHandle & handle) throw ()
+  {
+    const int id = handle.id();
+    if (id < 0) return FieldView<T>();
+    ASSERT2 ("Field::view()",
+	     "Field %s precision does not match view element size %d",
+	     field_name(id).c_str(), int(sizeof(T)),
+	     bytes_per_element(id) == int(sizeof(T)));
+    int mx,my,mz;
+    int gx,gy,gz;
+    field_data_->dimensions (id,&mx,&my,&mz);
+    field_descr_->ghost_depth (id,&gx,&gy,&gz);
+    return FieldView<T> ((T *) field_data_->values(id), mx,my,mz, gx,gy,gz);
+  }
+
   /// Return raw pointer to the array of all fields.  Const since
   /// otherwise dangerous due to varying field sizes, precisions,
   /// padding and alignment
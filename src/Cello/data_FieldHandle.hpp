@@ -0,0 +1,62 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldHandle.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Data] Declaration of the FieldHandle class
+
+#ifndef DATA_FIELD_HANDLE_HPP
+#define DATA_FIELD_HANDLE_HPP
+
+class FieldHandle {
+
+  /// @class    FieldHandle
+  /// @ingroup  Field
+  /// @brief    [\ref Data] A field id resolved once from its name
+  ///
+  /// Methods create FieldHandles at construction and store them, so
+  /// that accessing a Block's field with Field::view() avoids the
+  /// string lookup in FieldDescr::field_id().  Field ids are fixed
+  /// once fields are inserted, so handles may be pup'ed with the
+  /// Method.
+
+public: // interface
+
+  /// Create an undefined handle
+  FieldHandle() throw()
+    : id_(-1)
+  { }
+
+  /// Create a handle for the named field, which is undefined if the
+  /// field does not exist
+  FieldHandle(const FieldDescr * field_descr,
+	      const std::string & name) throw()
+    : id_(field_descr->is_field(name) ? field_descr->field_id(name) : -1)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    // NOTE: change this function whenever attributes change
+    p | id_;
+  }
+
+  /// Return whether the handle refers to an existing field
+  bool is_field() const throw()
+  { return id_ >= 0; }
+
+  /// Return the field id, or -1 if undefined
+  int id() const throw()
+  { return id_; }
+
+private: // attributes
+
+  /// Field id in the FieldDescr
+  int id_;
+
+  // NOTE: change pup() function whenever attributes change
+
+};
+
+#endif /* DATA_FIELD_HANDLE_HPP */
@@ -0,0 +1,84 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldView.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Data] Declaration of the FieldView class
+
+#ifndef DATA_FIELD_VIEW_HPP
+#define DATA_FIELD_VIEW_HPP
+
+template <class T>
+class FieldView {
+
+  /// @class    FieldView
+  /// @ingroup  Field
+  /// @brief    [\ref Data] Typed view of one field on a Block, with
+  /// its array dimensions and ghost depth
+  ///
+  /// Created with Field::view() from a FieldHandle.  A view of an
+  /// undefined field has NULL values.  Views are transient: they are
+  /// invalidated if the Block's field storage is reallocated.
+
+public: // interface
+
+  /// Create an empty view
+  FieldView() throw()
+    : values_(NULL)
+  {
+    m_[0] = m_[1] = m_[2] = 0;
+    g_[0] = g_[1] = g_[2] = 0;
+  }
+
+  /// Create a view of the given array
+  FieldView(T * values,
+	    int mx, int my, int mz,
+	    int gx, int gy, int gz) throw()
+    : values_(values)
+  {
+    m_[0] = mx; m_[1] = my; m_[2] = mz;
+    g_[0] = gx; g_[1] = gy; g_[2] = gz;
+  }
+
+  /// Return whether the view refers to field values
+  bool is_valid() const throw()
+  { return values_ != NULL; }
+
+  /// Return the field values, including ghost zones
+  T * values() const throw()
+  { return values_; }
+
+  /// Return the array dimensions, including ghost zones
+  void dimensions(int * mx, int * my = 0, int * mz = 0) const throw()
+  {
+    if (mx) (*mx) = m_[0];
+    if (my) (*my) = m_[1];
+    if (mz) (*mz) = m_[2];
+  }
+
+  /// Return the ghost depth
+  void ghost_depth(int * gx, int * gy = 0, int * gz = 0) const throw()
+  {
+    if (gx) (*gx) = g_[0];
+    if (gy) (*gy) = g_[1];
+    if (gz) (*gz) = g_[2];
+  }
+
+  /// Return the value at the given array index, counting ghost zones
+  T & operator() (int ix, int iy = 0, int iz = 0) const throw()
+  { return values_[ix + m_[0]*(iy + m_[1]*iz)]; }
+
+private: // attributes
+
+  /// Field values
+  T * values_;
+
+  /// Array dimensions
+  int m_[3];
+
+  /// Ghost depth
+  int g_[3];
+
+};
+
+#endif /* DATA_FIELD_VIEW_HPP */
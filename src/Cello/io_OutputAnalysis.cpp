@@ -0,0 +1,575 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputAnalysis.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implementation of the OutputAnalysis class
+///
+/// Each output appends lines "cycle time field analysis values..." to
+/// the file, with one value for sum, mean, min, and max, the volume
+/// fraction in each bin for histogram, and the power in each shell
+/// k = 1, ..., spectrum_kmax for spectrum.
+///
+/// If analysis_weight_field is set, each field is multiplied by it
+/// first, e.g. by "density" to integrate specific quantities such as
+/// total_energy into conserved ones.
+///
+/// If analysis_conserved_tolerance is positive, each later "sum" is
+/// also asserted to match the first one to that relative tolerance,
+/// so that conservation can be checked in the regression tests.
+
+#include "cello.hpp"
+#include "test.hpp"
+#include "io.hpp"
+
+#include <complex>
+
+//----------------------------------------------------------------------
+
+OutputAnalysis::OutputAnalysis
+(
+ int index,
+ const Factory * factory,
+ Config * config,
+ int process_count
+) throw ()
+  : Output(index,factory),
+    analysis_list_(),
+    histogram_bins_(config->output_analysis_histogram_bins[index]),
+    histogram_min_(config->output_analysis_histogram_min[index]),
+    histogram_max_(config->output_analysis_histogram_max[index]),
+    histogram_log_(config->output_analysis_histogram_log[index]),
+    spectrum_kmax_(config->output_analysis_spectrum_kmax[index]),
+    weight_field_(config->output_analysis_weight_field[index]),
+    conserved_tolerance_(config->output_analysis_conserved_tolerance[index]),
+    sum_initial_(),
+    rank_(config->mesh_root_rank),
+    field_names_(),
+    reduction_(),
+    fp_(NULL)
+{
+  // Override default Output::process_stride_: only root writes
+  set_process_stride(process_count);
+
+  file_name_ = config->output_list[index] + ".dat";
+
+  for (int axis=0; axis<3; axis++) {
+    lower_[axis] = config->domain_lower[axis];
+    upper_[axis] = config->domain_upper[axis];
+  }
+
+  const std::vector<std::string> & list = config->output_analysis_list[index];
+
+  for (size_t i=0; i<list.size(); i++) {
+    int analysis = analysis_unknown;
+    if      (list[i] == "sum")       analysis = analysis_sum;
+    else if (list[i] == "mean")      analysis = analysis_mean;
+    else if (list[i] == "min")       analysis = analysis_min;
+    else if (list[i] == "max")       analysis = analysis_max;
+    else if (list[i] == "histogram") analysis = analysis_histogram;
+    else if (list[i] == "spectrum")  analysis = analysis_spectrum;
+    else {
+      ERROR2 ("OutputAnalysis::OutputAnalysis()",
+	      "Unrecognized Output:%s:analysis_list value %s",
+	      config->output_list[index].c_str(), list[i].c_str());
+    }
+    analysis_list_.push_back(analysis);
+  }
+
+  ASSERT1 ("OutputAnalysis::OutputAnalysis()",
+	   "Output:%s:analysis_histogram_bins must be positive",
+	   config->output_list[index].c_str(),
+	   histogram_bins_ > 0);
+
+  ASSERT1 ("OutputAnalysis::OutputAnalysis()",
+	   "Output:%s:analysis_histogram_max must be greater than "
+	   "analysis_histogram_min",
+	   config->output_list[index].c_str(),
+	   histogram_max_ > histogram_min_);
+
+  ASSERT1 ("OutputAnalysis::OutputAnalysis()",
+	   "Output:%s:analysis_histogram_min must be positive "
+	   "if analysis_histogram_log is true",
+	   config->output_list[index].c_str(),
+	   ! histogram_log_ || histogram_min_ > 0.0);
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::pup (PUP::er &p)
+{
+  TRACEPUP;
+
+  // NOTE: change this function whenever attributes change
+
+  Output::pup(p);
+
+  p | analysis_list_;
+  p | histogram_bins_;
+  p | histogram_min_;
+  p | histogram_max_;
+  p | histogram_log_;
+  p | spectrum_kmax_;
+  p | weight_field_;
+  p | conserved_tolerance_;
+  p | sum_initial_;
+  p | rank_;
+  PUParray(p,lower_,3);
+  PUParray(p,upper_,3);
+  p | field_names_;
+
+  if (p.isUnpacking()) fp_ = NULL;
+}
+
+//======================================================================
+
+void OutputAnalysis::open () throw()
+{
+  if (is_writer()) {
+
+    std::string file_name = expand_file_name_(&file_name_,&file_args_);
+
+    Monitor::instance()->print
+      ("Output","writing analysis file %s", file_name.c_str());
+
+    fp_ = fopen (file_name.c_str(),"a");
+
+    ASSERT1 ("OutputAnalysis::open()",
+	     "Cannot open analysis file %s",
+	     file_name.c_str(), fp_ != NULL);
+
+    if (count_ == 0) {
+      fprintf (fp_,"# cycle time field analysis values\n");
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::close () throw()
+{
+  if (fp_ == NULL) return;
+
+  // Values of each field follow the total volume
+
+  int index = 1;
+
+  for (size_t i_f=0; i_f<field_names_.size(); i_f++) {
+    for (size_t i_a=0; i_a<analysis_list_.size(); i_a++) {
+      const int analysis = analysis_list_[i_a];
+      write_line_ (field_names_[i_f], analysis, index);
+      if (analysis == analysis_sum && conserved_tolerance_ > 0.0) {
+	check_conserved_ (i_f, reduction_.value(index));
+      }
+      index += size_(analysis);
+    }
+  }
+
+  fclose (fp_);
+  fp_ = NULL;
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::write_simulation
+( const Simulation * simulation ) throw()
+{
+  const FieldDescr * field_descr = simulation->field_descr();
+
+  field_names_.clear();
+  for (it_field_->first(); ! it_field_->done(); it_field_->next()  ) {
+    field_names_.push_back(field_descr->field_name(it_field_->value()));
+  }
+
+  // Initialize the Reduction with the identity of each operation
+
+  const long double huge = std::numeric_limits<double>::max();
+
+  reduction_ = Reduction();
+
+  reduction_.add (reduce_sum_kahan, 0.0);   // total volume
+
+  for (size_t i_f=0; i_f<field_names_.size(); i_f++) {
+    for (size_t i_a=0; i_a<analysis_list_.size(); i_a++) {
+      const int analysis = analysis_list_[i_a];
+      const int n = size_(analysis);
+      for (int i=0; i<n; i++) {
+	switch (analysis) {
+	case analysis_sum:
+	case analysis_mean:      reduction_.add (reduce_sum_kahan, 0.0);  break;
+	case analysis_min:       reduction_.add (reduce_min,       huge); break;
+	case analysis_max:       reduction_.add (reduce_max,      -huge); break;
+	case analysis_histogram:
+	case analysis_spectrum:  reduction_.add (reduce_sum,       0.0);  break;
+	default:                                                          break;
+	}
+      }
+    }
+  }
+
+  Output::write_simulation(simulation);
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::write_block
+( const Block * block,
+  const FieldDescr * field_descr) throw()
+{
+  if (! block->is_leaf()) return;
+
+  const FieldData * field_data = block->data()->field_data();
+
+  int nx,ny,nz;
+  field_data->size(&nx,&ny,&nz);
+
+  const int n = nx*ny*nz;
+
+  double lower[3],upper[3];
+  block->data()->lower(&lower[0],&lower[1],&lower[2]);
+  block->data()->upper(&upper[0],&upper[1],&upper[2]);
+
+  const double h[3] = { (upper[0] - lower[0]) / nx,
+			(upper[1] - lower[1]) / ny,
+			(upper[2] - lower[2]) / nz };
+
+  const double volume_cell = h[0]*h[1]*h[2];
+
+  double volume_domain = 1.0;
+  for (int axis=0; axis<3; axis++) volume_domain *= (upper_[axis]-lower_[axis]);
+
+  reduction_.accumulate (0, n*volume_cell);
+
+  std::vector<double> f (n);
+
+  // Values of the weight field, if any, multiply each analyzed field
+
+  std::vector<double> w;
+  if (weight_field_ != "") {
+    ASSERT1 ("OutputAnalysis::write_block()",
+	     "Unknown analysis_weight_field %s",
+	     weight_field_.c_str(), field_descr->is_field(weight_field_));
+    w.resize(n);
+    copy_field_ (field_data,field_descr->field_id(weight_field_),&w[0]);
+  }
+
+  int index = 1;
+
+  for (it_field_->first(); ! it_field_->done(); it_field_->next()  ) {
+
+    const int index_field = it_field_->value();
+
+    copy_field_ (field_data,index_field,&f[0]);
+
+    for (size_t i=0; i<w.size(); i++) f[i] *= w[i];
+
+    for (size_t i_a=0; i_a<analysis_list_.size(); i_a++) {
+
+      const int analysis = analysis_list_[i_a];
+
+      if (analysis == analysis_sum || analysis == analysis_mean) {
+
+	double sum = 0.0;
+	for (int i=0; i<n; i++) sum += f[i];
+	reduction_.accumulate (index, sum*volume_cell);
+
+      } else if (analysis == analysis_min) {
+
+	double value = f[0];
+	for (int i=1; i<n; i++) value = MIN(value,f[i]);
+	reduction_.accumulate (index, value);
+
+      } else if (analysis == analysis_max) {
+
+	double value = f[0];
+	for (int i=1; i<n; i++) value = MAX(value,f[i]);
+	reduction_.accumulate (index, value);
+
+      } else if (analysis == analysis_histogram) {
+
+	// Values outside the range are counted in the end bins
+
+	const double x0 = histogram_log_ ? log10(histogram_min_) : histogram_min_;
+	const double x1 = histogram_log_ ? log10(histogram_max_) : histogram_max_;
+	const double scale = histogram_bins_ / (x1 - x0);
+
+	std::vector<int> count (histogram_bins_,0);
+	for (int i=0; i<n; i++) {
+	  int bin = 0;
+	  if (! histogram_log_ || f[i] > 0.0) {
+	    const double x = histogram_log_ ? log10(f[i]) : f[i];
+	    bin = (x > x0) ? int(scale*(x - x0)) : 0;
+	    bin = MIN(bin,histogram_bins_ - 1);
+	  }
+	  ++count[bin];
+	}
+	for (int bin=0; bin<histogram_bins_; bin++) {
+	  if (count[bin] > 0) {
+	    reduction_.accumulate (index + bin, count[bin]*volume_cell);
+	  }
+	}
+
+      } else if (analysis == analysis_spectrum) {
+
+	spectrum_block_ (&f[0],nx,ny,nz,lower,h,
+			 volume_cell/volume_domain,index);
+
+      }
+
+      index += size_(analysis);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::prepare_remote (int * n, char ** buffer) throw()
+{
+  // Allocate buffer (deallocated in cleanup_remote())
+
+  (*n) = reduction_.buffer_size();
+  (*buffer) = new char [ *n ];
+
+  reduction_.pack (*buffer);
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::update_remote  ( int n, char * buffer) throw()
+{
+  reduction_.accumulate (Reduction(n,buffer));
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::cleanup_remote  (int * n, char ** buffer) throw()
+{
+  delete [] (*buffer);
+  (*buffer) = NULL;
+}
+
+//======================================================================
+
+int OutputAnalysis::size_ (int analysis) const throw()
+{
+  if (analysis == analysis_histogram) {
+    return histogram_bins_;
+  } else if (analysis == analysis_spectrum) {
+    // real and imaginary parts of each Fourier coefficient
+    return 2*num_k_(0)*num_k_(1)*num_k_(2);
+  } else {
+    return 1;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::copy_field_
+(const FieldData * field_data, int index_field, double * f) const throw()
+{
+  int nx,ny,nz;
+  field_data->size(&nx,&ny,&nz);
+
+  int mx,my;
+  field_data->dimensions (index_field,&mx,&my);
+
+  const char * values = field_data->unknowns(index_field);
+
+  switch (field_data->precision(index_field)) {
+  case precision_single:
+    copy_values_ ((const float *)values,mx,my,nx,ny,nz,f);
+    break;
+  case precision_double:
+    copy_values_ ((const double *)values,mx,my,nx,ny,nz,f);
+    break;
+  case precision_extended80:
+  case precision_extended96:
+  case precision_quadruple:
+    copy_values_ ((const long double *)values,mx,my,nx,ny,nz,f);
+    break;
+  default:
+    ERROR1 ("OutputAnalysis::copy_field_()",
+	    "Unsupported precision %d",
+	    field_data->precision(index_field));
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void OutputAnalysis::copy_values_
+(const T * values, int mx, int my,
+ int nx, int ny, int nz, double * f) const throw()
+{
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	f[ix + nx*(iy + ny*iz)] = values[ix + mx*(iy + my*iz)];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::spectrum_block_
+(const double * f, int nx, int ny, int nz,
+ const double lower[3], const double h[3],
+ double weight, int index) throw()
+{
+  // F(k) = sum f(x) exp(-2 pi i k.(x - lower)/L) dV / V, summed one
+  // axis at a time to reduce the work per cell to num_k_(0)
+
+  typedef std::complex<double> complex_type;
+
+  const int kmax = spectrum_kmax_;
+  const int n3[3] = {nx,ny,nz};
+  const int nk3[3] = {num_k_(0),num_k_(1),num_k_(2)};
+
+  std::vector<complex_type> e3[3];
+
+  for (int axis=0; axis<3; axis++) {
+    const int n  = n3[axis];
+    const int nk = nk3[axis];
+    const double length = upper_[axis] - lower_[axis];
+    e3[axis].resize(nk*n);
+    for (int k=0; k<nk; k++) {
+      const int kk = (nk == 1) ? 0 : k - kmax;
+      for (int i=0; i<n; i++) {
+	const double x = lower[axis] + (i + 0.5)*h[axis] - lower_[axis];
+	const double theta = -2.0*cello::pi*kk*x/length;
+	e3[axis][k*n+i] = complex_type(cos(theta),sin(theta));
+      }
+    }
+  }
+
+  const int nkx = nk3[0];
+  const int nky = nk3[1];
+  const int nkz = nk3[2];
+
+  std::vector<complex_type> a (nkx*ny*nz);
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      const double * f_row = f + nx*(iy + ny*iz);
+      for (int kx=0; kx<nkx; kx++) {
+	const complex_type * e = &e3[0][kx*nx];
+	complex_type sum = 0.0;
+	for (int ix=0; ix<nx; ix++) sum += f_row[ix]*e[ix];
+	a[kx + nkx*(iy + ny*iz)] = sum;
+      }
+    }
+  }
+
+  std::vector<complex_type> b (nkx*nky*nz);
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int ky=0; ky<nky; ky++) {
+      const complex_type * e = &e3[1][ky*ny];
+      for (int kx=0; kx<nkx; kx++) {
+	complex_type sum = 0.0;
+	for (int iy=0; iy<ny; iy++) sum += a[kx + nkx*(iy + ny*iz)]*e[iy];
+	b[kx + nkx*(ky + nky*iz)] = sum;
+      }
+    }
+  }
+
+  for (int kz=0; kz<nkz; kz++) {
+    const complex_type * e = &e3[2][kz*nz];
+    for (int ky=0; ky<nky; ky++) {
+      for (int kx=0; kx<nkx; kx++) {
+	complex_type sum = 0.0;
+	for (int iz=0; iz<nz; iz++) sum += b[kx + nkx*(ky + nky*iz)]*e[iz];
+	const int k = kx + nkx*(ky + nky*kz);
+	reduction_.accumulate (index + 2*k,   weight*sum.real());
+	reduction_.accumulate (index + 2*k+1, weight*sum.imag());
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::check_conserved_ (int i_f, double sum) throw()
+{
+  // The first output of each field is the reference value
+
+  if (i_f >= int(sum_initial_.size())) {
+    sum_initial_.push_back(sum);
+    return;
+  }
+
+  const double err_rel = cello::err_rel(sum,sum_initial_[i_f]);
+
+  Monitor * monitor = Monitor::instance();
+  monitor->print ("Testing","%s sum relative error: %g",
+		  field_names_[i_f].c_str(),err_rel);
+
+  unit_class ("OutputAnalysis");
+  unit_func  ("conserved");
+  unit_assert (err_rel < conserved_tolerance_);
+}
+
+//----------------------------------------------------------------------
+
+void OutputAnalysis::write_line_
+(const std::string & field_name, int analysis, int index) throw()
+{
+  const char * name[] =
+    { "unknown", "sum", "mean", "min", "max", "histogram", "spectrum" };
+
+  fprintf (fp_,"%d %.10g %s %s", cycle_, time_,
+	   field_name.c_str(), name[analysis]);
+
+  const double volume = reduction_.value(0);
+
+  if (analysis == analysis_mean) {
+
+    fprintf (fp_," %.10g",double(reduction_.value(index) / volume));
+
+  } else if (analysis == analysis_histogram) {
+
+    for (int bin=0; bin<histogram_bins_; bin++) {
+      fprintf (fp_," %.10g",double(reduction_.value(index+bin) / volume));
+    }
+
+  } else if (analysis == analysis_spectrum) {
+
+    // Sum |F(k)|^2 over shells k - 1/2 <= |k| < k + 1/2
+
+    const int kmax = spectrum_kmax_;
+    const int nkx = num_k_(0);
+    const int nky = num_k_(1);
+    const int nkz = num_k_(2);
+
+    std::vector<double> power (kmax+1, 0.0);
+
+    for (int kz=0; kz<nkz; kz++) {
+      const int kkz = (nkz == 1) ? 0 : kz - kmax;
+      for (int ky=0; ky<nky; ky++) {
+	const int kky = (nky == 1) ? 0 : ky - kmax;
+	for (int kx=0; kx<nkx; kx++) {
+	  const int kkx = (nkx == 1) ? 0 : kx - kmax;
+	  const int shell = int(sqrt(double(kkx*kkx + kky*kky + kkz*kkz)) + 0.5);
+	  if (shell <= kmax) {
+	    const int k = kx + nkx*(ky + nky*kz);
+	    const double re = reduction_.value(index + 2*k);
+	    const double im = reduction_.value(index + 2*k+1);
+	    power[shell] += re*re + im*im;
+	  }
+	}
+      }
+    }
+
+    for (int k=1; k<=kmax; k++) {
+      fprintf (fp_," %.10g",power[k]);
+    }
+
+  } else {
+
+    fprintf (fp_," %.10g",double(reduction_.value(index)));
+
+  }
+
+  fprintf (fp_,"\n");
+}
@@ -0,0 +1,171 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputAnalysis.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Io] Declaration of the OutputAnalysis class
+
+#ifndef IO_OUTPUT_ANALYSIS_HPP
+#define IO_OUTPUT_ANALYSIS_HPP
+
+class Config;
+class Factory;
+class FieldData;
+class FieldDescr;
+
+/// @enum     analysis_type
+/// @brief    global quantity computed by OutputAnalysis for each field
+enum analysis_type {
+  analysis_unknown,
+  analysis_sum,        // volume integral
+  analysis_mean,       // volume-weighted mean
+  analysis_min,        // minimum
+  analysis_max,        // maximum
+  analysis_histogram,  // volume fraction in each bin
+  analysis_spectrum    // power in each wavenumber shell
+};
+
+class OutputAnalysis : public Output {
+
+  /// @class    OutputAnalysis
+  /// @ingroup  Io
+  /// @brief [\ref Io] Reduce fields over leaf Blocks and append the
+  /// results to a text time-series file
+  ///
+  /// Each process accumulates its leaf Blocks' contributions in a
+  /// Reduction, which is combined on the root process and written as
+  /// one line per field and analysis.  Power spectra are computed
+  /// for wavenumbers up to spectrum_kmax with a direct Fourier sum
+  /// over cells, so they are exact for any mesh refinement.
+
+public: // functions
+
+  /// Empty constructor for Charm++ pup()
+  OutputAnalysis() throw() {}
+
+  /// Create an uninitialized OutputAnalysis object
+  OutputAnalysis(int index,
+		 const Factory * factory,
+		 Config * config,
+		 int process_count) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(OutputAnalysis);
+
+  /// Charm++ PUP::able migration constructor
+  OutputAnalysis (CkMigrateMessage *m) : Output (m) {}
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+public: // virtual functions
+
+  /// Open (or create) a file for IO
+  virtual void open () throw();
+
+  /// Write the reduced values if root process
+  virtual void close () throw();
+
+  /// Initialize the Reduction and start accumulating block data
+  virtual void write_simulation ( const Simulation * simulation ) throw();
+
+  /// Accumulate leaf block data
+  virtual void write_block
+  ( const Block      * block,
+    const FieldDescr * field_descr) throw();
+
+  /// Not used: fields are accumulated in write_block()
+  virtual void write_field_data
+  ( const FieldData * field_data,
+    const FieldDescr * field_descr,
+    int field_index) throw()
+  { }
+
+  /// Prepare local array with data to be sent to remote chare for processing
+  virtual void prepare_remote (int * n, char ** buffer) throw();
+
+  /// Accumulate and write data sent from a remote processes
+  virtual void update_remote  ( int n, char * buffer) throw();
+
+  /// Free local array if allocated; NOP if not
+  virtual void cleanup_remote (int * n, char ** buffer) throw();
+
+private: // functions
+
+  /// Return the number of values for the given analysis
+  int size_ (int analysis) const throw();
+
+  /// Number of wavenumbers -kmax <= k <= kmax along the given axis
+  int num_k_ (int axis) const throw()
+  { return (axis < rank_) ? 2*spectrum_kmax_ + 1 : 1; }
+
+  /// Copy the values of the given field to a double array
+  void copy_field_ (const FieldData * field_data, int index_field,
+		    double * f) const throw();
+
+  /// Copy the field values of the block to a double array
+  template <class T>
+  void copy_values_ (const T * values, int mx, int my,
+		     int nx, int ny, int nz, double * f) const throw();
+
+  /// Add the Fourier coefficients of the block values f to the
+  /// Reduction starting at index
+  void spectrum_block_ (const double * f, int nx, int ny, int nz,
+			const double lower[3], const double h[3],
+			double weight, int index) throw();
+
+  /// Compare the sum of field i_f with its value at the first output
+  void check_conserved_ (int i_f, double sum) throw();
+
+  /// Write the line for the given field and analysis
+  void write_line_ (const std::string & field_name, int analysis,
+		    int index) throw();
+
+private: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Analyses computed for each field
+  std::vector<int> analysis_list_;
+
+  /// Number of histogram bins
+  int histogram_bins_;
+
+  /// Range of histogram values
+  double histogram_min_;
+  double histogram_max_;
+
+  /// Whether histogram bins are in log10 of the values
+  bool histogram_log_;
+
+  /// Largest wavenumber in power spectra
+  int spectrum_kmax_;
+
+  /// Field multiplying each analyzed field, if not ""
+  std::string weight_field_;
+
+  /// Relative tolerance for asserting that sums are conserved; 0 if off
+  double conserved_tolerance_;
+
+  /// Sum of each field at the first output
+  std::vector<double> sum_initial_;
+
+  /// Dimensionality of the problem
+  int rank_;
+
+  /// Domain extents
+  double lower_[3];
+  double upper_[3];
+
+  /// Names of the fields analyzed
+  std::vector<std::string> field_names_;
+
+  /// Values reduced for the current output [not pup'ed]
+  Reduction reduction_;
+
+  /// Output file [not pup'ed]
+  FILE * fp_;
+
+};
+
+#endif /* IO_OUTPUT_ANALYSIS_HPP */
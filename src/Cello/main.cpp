@@ -47,6 +47,9 @@ void Main::exit_()
 
 #endif
 
+  Memory * memory = Memory::instance();
+  if (memory) memory->print_sites();
+
   if (Monitor::instance()) {
     Monitor::instance()->print ("","END CELLO");
   }
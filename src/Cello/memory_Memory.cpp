@@ -11,6 +11,17 @@
 
 #ifdef CONFIG_USE_MEMORY
 Memory Memory::instance_; // (singleton design pattern)
+
+/// Index of the calling thread's MemoryCounters, or -1 if unassigned
+static __thread int memory_thread = -1;
+
+/// Number of the calling thread's allocations since its last sample
+static __thread int memory_sample_count = 0;
+
+/// Add value to counter, atomically if the counters are shared
+#define MEMORY_ADD(SHARED,COUNTER,VALUE)				\
+  if (SHARED) __sync_fetch_and_add(&(COUNTER),(long long)(VALUE));	\
+  else (COUNTER) += (VALUE);
 #endif
 
 //======================================================================
@@ -23,6 +34,8 @@ void Memory::initialize_() throw ()
 
   index_group_ = 0;
 
+  sample_interval_ = 0;
+
   if (group_name_.size() == 0) {
     new_group ("Cello");
   }
@@ -37,8 +50,23 @@ void Memory::initialize_() throw ()
 
 //----------------------------------------------------------------------
 
-void * Memory::allocate ( size_t bytes ) throw ()
+#ifdef CONFIG_USE_MEMORY
+
+int Memory::thread_() throw ()
+{
+  if (memory_thread < 0) {
+    memory_thread = __sync_fetch_and_add(&num_threads_,1);
+  }
+  return MIN(memory_thread,MEMORY_MAX_THREADS - 1);
+}
+
+#endif
+
+//----------------------------------------------------------------------
+
+void * Memory::allocate ( size_t bytes, void * site ) throw ()
 /// @param  bytes   Number of bytes to allocate
+/// @param  site    Address of the caller for allocation site sampling
 /// @return        Pointer to the allocated memory
 {
 #ifdef CONFIG_USE_MEMORY
@@ -59,18 +87,34 @@ void * Memory::allocate ( size_t bytes ) throw ()
       memset (&buffer[2],fill_new_,bytes);
     }
 
-    ++ new_calls_[0] ;
-    bytes_curr_[0] += bytes;
-    bytes_high_[0]    = MAX(bytes_high_[0],   bytes_curr_[0]);
-    bytes_highest_[0] = MAX(bytes_highest_[0],bytes_curr_[0]);
-
-    if (index_group_ != 0) {
-      ++ new_calls_[index_group_] ;
-      bytes_curr_[index_group_] += bytes;
-      bytes_high_[index_group_]    = MAX(bytes_high_[index_group_],
-					 bytes_curr_[index_group_]);
-      bytes_highest_[index_group_] = MAX(bytes_highest_[index_group_],
-					 bytes_curr_[index_group_]);
+    const int thread = thread_();
+    const bool shared = (thread == MEMORY_MAX_THREADS - 1);
+    MemoryCounters & counters = counters_[thread];
+
+    MEMORY_ADD (shared, counters.new_calls[0], 1);
+    MEMORY_ADD (shared, counters.bytes_curr[0], bytes);
+    counters.bytes_high[0]    = MAX(counters.bytes_high[0],
+				    counters.bytes_curr[0]);
+    counters.bytes_highest[0] = MAX(counters.bytes_highest[0],
+				    counters.bytes_curr[0]);
+
+    const int index_group = index_group_;
+
+    if (index_group != 0) {
+      MEMORY_ADD (shared, counters.new_calls[index_group], 1);
+      MEMORY_ADD (shared, counters.bytes_curr[index_group], bytes);
+      counters.bytes_high[index_group]    =
+	MAX(counters.bytes_high[index_group],
+	    counters.bytes_curr[index_group]);
+      counters.bytes_highest[index_group] =
+	MAX(counters.bytes_highest[index_group],
+	    counters.bytes_curr[index_group]);
+    }
+
+    if (sample_interval_ && site &&
+	++memory_sample_count >= sample_interval_) {
+      memory_sample_count = 0;
+      sample_ (thread, site, bytes);
     }
 
   } else {
@@ -96,14 +140,21 @@ void Memory::deallocate ( void * pointer ) throw()
 
     int bytes = buffer[0];
 
-    ++ delete_calls_[0] ;
-    bytes_curr_[0] -= bytes;
+    // Counted by the deallocating thread, so one thread's current
+    // bytes may be negative; only sums over threads are meaningful
+
+    const int thread = thread_();
+    const bool shared = (thread == MEMORY_MAX_THREADS - 1);
+    MemoryCounters & counters = counters_[thread];
+
+    MEMORY_ADD (shared, counters.delete_calls[0], 1);
+    MEMORY_ADD (shared, counters.bytes_curr[0], -bytes);
 
     int index_group = buffer[1];
 
     if (index_group != 0) {
-      ++ delete_calls_[index_group] ;
-      bytes_curr_[index_group] -= bytes;
+      MEMORY_ADD (shared, counters.delete_calls[index_group], 1);
+      MEMORY_ADD (shared, counters.bytes_curr[index_group], -bytes);
     }
 
     if (fill_delete_) {
@@ -119,28 +170,70 @@ void Memory::deallocate ( void * pointer ) throw()
 
 //----------------------------------------------------------------------
 
+#ifdef CONFIG_USE_MEMORY
+
+void Memory::sample_ (int thread, void * site, size_t bytes) throw ()
+{
+  // Open addressing on the site address; samples are dropped if the
+  // thread's table is full
+
+  MemorySite * sites = sites_[thread];
+
+  const size_t hash = ((size_t)site >> 4) % MEMORY_MAX_SITES;
+
+  for (int k=0; k<MEMORY_MAX_SITES; k++) {
+    MemorySite & entry = sites[(hash + k) % MEMORY_MAX_SITES];
+    if (entry.site == site || entry.site == 0) {
+      entry.site   = site;
+      entry.count += 1;
+      entry.bytes += bytes;
+      return;
+    }
+  }
+}
+
+#endif
+
+//----------------------------------------------------------------------
+
 void Memory::new_group ( std::string group_name ) throw ()
 /// @param  group_name  Name of the group
 {
 #ifdef CONFIG_USE_MEMORY
 
+  ASSERT1 ("Memory::new_group()",
+	   "Too many memory groups: MEMORY_MAX_GROUPS = %d",
+	   MEMORY_MAX_GROUPS,
+	   int(group_name_.size()) < MEMORY_MAX_GROUPS);
+
   group_name_.push_back(group_name);
   bytes_limit_  .push_back(0);
-  bytes_curr_   .push_back(0);
-  bytes_high_   .push_back(0);
-  bytes_highest_.push_back(0);
-  new_calls_    .push_back(0);
-  delete_calls_ .push_back(0);
   
 #endif
 }
 
 //----------------------------------------------------------------------
 
+#ifdef CONFIG_USE_MEMORY
+
+/// Sum the given counter over threads for the group
+
+#define MEMORY_SUM(SUM,COUNTER,INDEX_GROUP)				\
+  long long SUM = 0;							\
+  for (int thread=0;							\
+       thread<MIN(num_threads_,MEMORY_MAX_THREADS); thread++) {	\
+    SUM += counters_[thread].COUNTER[INDEX_GROUP];			\
+  }
+
+#endif
+
+//----------------------------------------------------------------------
+
 long long Memory::bytes ( std::string group_name ) throw ()
 {
 #ifdef CONFIG_USE_MEMORY
-  return bytes_curr_[index_group(group_name)];
+  MEMORY_SUM(bytes,bytes_curr,index_group(group_name));
+  return bytes;
 #else
   return 0;
 #endif
@@ -153,7 +246,8 @@ long long Memory::bytes_available ( std::string group_name ) throw ()
 #ifdef CONFIG_USE_MEMORY
   int index_group = this->index_group(group_name);
   if (bytes_limit_[index_group] != 0) {
-    return bytes_limit_[index_group] - bytes_curr_[index_group];
+    MEMORY_SUM(bytes,bytes_curr,index_group);
+    return bytes_limit_[index_group] - bytes;
   } else {
     return 0;
   }
@@ -168,10 +262,11 @@ float Memory::efficiency ( std::string group_name ) throw ()
 {
 #ifdef CONFIG_USE_MEMORY
   int index_group = this->index_group(group_name);
+  MEMORY_SUM(bytes,bytes_curr,index_group);
   printf ("bytes_limit_[%d] = %lld\n",index_group,bytes_limit_[index_group]);
-  printf ("bytes_curr_[%d] = %lld\n",index_group,bytes_curr_[index_group]);
+  printf ("bytes_curr_[%d] = %lld\n",index_group,bytes);
   if (bytes_limit_[index_group] != 0) {
-    return (float) bytes_curr_[index_group] / bytes_limit_[index_group];
+    return (float) bytes / bytes_limit_[index_group];
   } else {
     return 0.0;
   }
@@ -187,8 +282,9 @@ long long Memory::bytes_high ( std::string group_name ) throw ()
 {
 #ifdef CONFIG_USE_MEMORY
   int index_group = this->index_group(group_name);
-  TRACE1("bytes_high = %lld",bytes_high_[index_group]);
-  return bytes_high_[index_group];
+  MEMORY_SUM(bytes_high,bytes_high,index_group);
+  TRACE1("bytes_high = %lld",bytes_high);
+  return bytes_high;
 #else
   return 0;
 #endif
@@ -200,8 +296,9 @@ long long Memory::bytes_highest ( std::string group_name ) throw ()
 {
 #ifdef CONFIG_USE_MEMORY
   int index_group = this->index_group(group_name);
-  TRACE1("bytes_highest = %lld",bytes_highest_[index_group]);
-  return bytes_highest_[index_group];
+  MEMORY_SUM(bytes_highest,bytes_highest,index_group);
+  TRACE1("bytes_highest = %lld",bytes_highest);
+  return bytes_highest;
 #else
   return 0;
 #endif
@@ -234,7 +331,8 @@ long long Memory::bytes_limit ( std::string group_name ) throw ()
 int Memory::num_new ( std::string group_name ) throw ()
 {
 #ifdef CONFIG_USE_MEMORY
-  return new_calls_[index_group(group_name)];
+  MEMORY_SUM(num_new,new_calls,index_group(group_name));
+  return num_new;
 #else
   return 0;
 #endif
@@ -245,7 +343,8 @@ int Memory::num_new ( std::string group_name ) throw ()
 int Memory::num_delete ( std::string group_name ) throw ()
 {
 #ifdef CONFIG_USE_MEMORY
-  return delete_calls_[index_group(group_name)];
+  MEMORY_SUM(num_delete,delete_calls,index_group(group_name));
+  return num_delete;
 #else
   return 0;
 #endif
@@ -259,15 +358,95 @@ void Memory::print () throw ()
   for (size_t i=0; i< group_name_.size(); i++) {
     Monitor * monitor = Monitor::instance();
     if (i == 0 || group_name_[i] != "") {
+      MEMORY_SUM(bytes_curr,   bytes_curr,   i);
+      MEMORY_SUM(bytes_high,   bytes_high,   i);
+      MEMORY_SUM(bytes_highest,bytes_highest,i);
+      MEMORY_SUM(new_calls,    new_calls,    i);
+      MEMORY_SUM(delete_calls, delete_calls, i);
       monitor->print ("Memory","Group %s",i ? group_name_[i].c_str(): "Total");
-      monitor->print ("Memory","  bytes         = %ld",long(bytes_curr_[i]));
-      monitor->print ("Memory","  bytes_high    = %ld",long(bytes_high_[i]));
-      monitor->print ("Memory","  bytes_highest = %ld",long(bytes_highest_[i]));
+      monitor->print ("Memory","  bytes         = %ld",long(bytes_curr));
+      monitor->print ("Memory","  bytes_high    = %ld",long(bytes_high));
+      monitor->print ("Memory","  bytes_highest = %ld",long(bytes_highest));
       monitor->print ("Memory","  bytes_limit   = %ld",long(bytes_limit_[i]));
-      monitor->print ("Memory","  new_calls     = %ld",long(new_calls_[i]));
-      monitor->print ("Memory","  delete_calls  = %ld",long(delete_calls_[i]));
+      monitor->print ("Memory","  new_calls     = %ld",long(new_calls));
+      monitor->print ("Memory","  delete_calls  = %ld",long(delete_calls));
+    }
+  }
+  print_sites();
+#endif
+}
+
+//----------------------------------------------------------------------
+
+int Memory::num_sites () const throw()
+{
+  int count = 0;
+#ifdef CONFIG_USE_MEMORY
+  for (int thread=0; thread<MIN(num_threads_,MEMORY_MAX_THREADS); thread++) {
+    for (int k=0; k<MEMORY_MAX_SITES; k++) {
+      if (sites_[thread][k].site != 0) ++count;
     }
   }
+#endif
+  return count;
+}
+
+//----------------------------------------------------------------------
+
+void Memory::print_sites (int num_sites) throw ()
+{
+#ifdef CONFIG_USE_MEMORY
+
+  if (sample_interval_ == 0) return;
+
+  // Don't count or sample the allocations made here
+
+  const bool is_active = is_active_;
+  is_active_ = false;
+
+  {
+    // Merge sites over threads
+
+    std::vector<MemorySite> sites;
+
+    for (int thread=0; thread<MIN(num_threads_,MEMORY_MAX_THREADS); thread++) {
+      for (int k=0; k<MEMORY_MAX_SITES; k++) {
+	const MemorySite & entry = sites_[thread][k];
+	if (entry.site == 0) continue;
+	size_t i;
+	for (i=0; i<sites.size() && sites[i].site != entry.site; i++) ;
+	if (i == sites.size()) {
+	  sites.push_back(entry);
+	} else {
+	  sites[i].count += entry.count;
+	  sites[i].bytes += entry.bytes;
+	}
+      }
+    }
+
+    // Print sites in order of sampled bytes; addresses may be
+    // converted to source lines with addr2line
+
+    Monitor * monitor = Monitor::instance();
+
+    monitor->print ("Memory","Allocation sites sampled every %d allocations",
+		    sample_interval_);
+
+    for (int n=0; n<num_sites && sites.size() > 0; n++) {
+      size_t i_max = 0;
+      for (size_t i=1; i<sites.size(); i++) {
+	if (sites[i].bytes > sites[i_max].bytes) i_max = i;
+      }
+      monitor->print ("Memory","  site %p samples %lld bytes %lld",
+		      sites[i_max].site,
+		      sites[i_max].count,
+		      sites[i_max].bytes);
+      sites.erase(sites.begin() + i_max);
+    }
+  }
+
+  is_active_ = is_active;
+
 #endif
 }
 
@@ -278,12 +457,20 @@ void Memory::reset() throw()
 #ifdef CONFIG_USE_MEMORY
   index_group_ = 0;
 
-  for (size_t i=0; i<bytes_curr_.size(); i++) {
-    bytes_curr_    [i] = 0;
-    bytes_high_    [i] = 0;
-    bytes_highest_ [i] = 0;
-    new_calls_     [i] = 0;
-    delete_calls_  [i] = 0;
+  for (int thread=0; thread<MEMORY_MAX_THREADS; thread++) {
+    MemoryCounters & counters = counters_[thread];
+    for (int i=0; i<MEMORY_MAX_GROUPS; i++) {
+      counters.bytes_curr    [i] = 0;
+      counters.bytes_high    [i] = 0;
+      counters.bytes_highest [i] = 0;
+      counters.new_calls     [i] = 0;
+      counters.delete_calls  [i] = 0;
+    }
+    for (int k=0; k<MEMORY_MAX_SITES; k++) {
+      sites_[thread][k].site  = 0;
+      sites_[thread][k].count = 0;
+      sites_[thread][k].bytes = 0;
+    }
   }
 #endif
 }
@@ -294,8 +481,11 @@ void Memory::reset_high() throw()
 {
 #ifdef CONFIG_USE_MEMORY
   TRACE("reset_high");
-  for (size_t i=0; i<bytes_high_.size(); i++) {
-    bytes_high_ [i] = bytes_curr_[i];
+  for (int thread=0; thread<MEMORY_MAX_THREADS; thread++) {
+    MemoryCounters & counters = counters_[thread];
+    for (int i=0; i<MEMORY_MAX_GROUPS; i++) {
+      counters.bytes_high [i] = counters.bytes_curr[i];
+    }
   }
 #endif
 }
@@ -306,7 +496,8 @@ void Memory::reset_high() throw()
 
 void *operator new (size_t bytes) throw (std::bad_alloc)
 {
-  size_t p = (size_t) Memory::instance()->allocate(bytes);
+  size_t p = (size_t) Memory::instance()->allocate
+    (bytes,__builtin_return_address(0));
   return (void *) p;
 }
 
@@ -318,7 +509,8 @@ void *operator new (size_t bytes) throw (std::bad_alloc)
 
 void *operator new [] (size_t bytes) throw (std::bad_alloc)
 {
-  size_t p = (size_t) Memory::instance()->allocate(bytes);
+  size_t p = (size_t) Memory::instance()->allocate
+    (bytes,__builtin_return_address(0));
   return (void *)(p);
 }
 
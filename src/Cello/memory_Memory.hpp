@@ -9,11 +9,44 @@
 #ifndef MEMORY_MEMORY_HPP
 #define MEMORY_MEMORY_HPP
 
+/// Maximum number of threads with their own counters; additional
+/// threads share the last counters using atomic updates
+#define MEMORY_MAX_THREADS 64
+
+/// Maximum number of groups defined with new_group()
+#define MEMORY_MAX_GROUPS  16
+
+/// Maximum number of distinct allocation sites sampled per thread
+#define MEMORY_MAX_SITES   256
+
+/// @struct   MemoryCounters
+/// @brief    [\ref Memory] Allocation counters for one thread
+struct MemoryCounters {
+  long long bytes_curr    [MEMORY_MAX_GROUPS];
+  long long bytes_high    [MEMORY_MAX_GROUPS];
+  long long bytes_highest [MEMORY_MAX_GROUPS];
+  long long new_calls     [MEMORY_MAX_GROUPS];
+  long long delete_calls  [MEMORY_MAX_GROUPS];
+};
+
+/// @struct   MemorySite
+/// @brief    [\ref Memory] Sampled allocations from one call site
+struct MemorySite {
+  void *    site;
+  long long count;
+  long long bytes;
+};
+
 class Memory {
 
   /// @class    Memory
   /// @ingroup  Memory
   /// @brief    [\ref Memory] Manage memory allocation and deallocation
+  ///
+  /// Each thread updates its own MemoryCounters, so allocation needs
+  /// no locking; queries such as bytes() sum over threads.  High-water
+  /// marks are summed per-thread high-water marks, which are exact
+  /// for a single thread and an upper bound otherwise.
 
 public: // interface
 
@@ -55,6 +88,7 @@ public: // interface
     p | fill_new_;
     p | fill_delete_;
     p | bytes_limit_;
+    p | sample_interval_;
 #endif
     WARNING ("Memory::pup()","Skipping index_group_");
     p | group_name_;
@@ -64,8 +98,8 @@ public: // interface
     }
   }
 
-  /// Allocate memory
-  void * allocate ( size_t size ) throw ();
+  /// Allocate memory, sampling the calling site if given
+  void * allocate ( size_t size, void * site = 0 ) throw ();
 
   /// De-allocate memory
   void deallocate ( void * pointer ) throw ();
@@ -122,6 +156,9 @@ public: // interface
   /// Print memory summary
   void print () throw ();
 
+  /// Print the allocation sites with the most sampled bytes
+  void print_sites (int num_sites = 20) throw ();
+
   /// Reset memory counters for the current group
   void reset () throw ();
 
@@ -161,6 +198,18 @@ public: // interface
 #endif
   };
 
+  /// Set the number of allocations per thread between samples of the
+  /// allocation site, or 0 for no sampling
+  void set_sample_interval (int interval)
+  {
+#ifdef CONFIG_USE_MEMORY
+    sample_interval_ = interval;
+#endif
+  };
+
+  /// Return the number of distinct allocation sites sampled
+  int num_sites () const throw();
+
   //======================================================================
 
 private: // functions
@@ -168,6 +217,14 @@ private: // functions
   /// Initialize the memory component
   void initialize_() throw ();
 
+#ifdef CONFIG_USE_MEMORY
+  /// Return the index of the calling thread's counters
+  int thread_() throw ();
+
+  /// Record a sampled allocation of the given bytes from site
+  void sample_ (int thread, void * site, size_t bytes) throw ();
+#endif
+
   //======================================================================
 
 private: // attributes
@@ -191,20 +248,17 @@ private: // attributes
   /// Limit on number of bytes to allocate.  Currently not checked.
   std::vector<long long> bytes_limit_;
 
-  /// Current bytes allocated for different groups
-  std::vector<long long> bytes_curr_;
-
-  /// Intervaled high-water bytes allocated for different groups
-  std::vector<long long> bytes_high_;
+  /// Allocations between allocation site samples, or 0 if none
+  int sample_interval_;
 
-  /// High-water bytes allocated for different groups
-  std::vector<long long> bytes_highest_;
+  /// Number of threads that have allocated memory
+  int num_threads_;
 
-  /// Number of calls to new for different groups
-  std::vector<long long> new_calls_;
+  /// Counters for each thread
+  MemoryCounters counters_[MEMORY_MAX_THREADS];
 
-  /// Number of calls to delete for different groups
-  std::vector<long long> delete_calls_;
+  /// Sampled allocation sites for each thread
+  MemorySite sites_[MEMORY_MAX_THREADS][MEMORY_MAX_SITES];
 
 #endif
 
@@ -78,7 +78,20 @@ Block::Block
   age_(0),
   face_level_last_(),
   name_(name()),
-  index_method_(-1)
+  index_method_(-1),
+  method_cost_(),
+  time_method_start_(0),
+  trace_thread_(-1),
+  trace_region_(perf_unknown),
+  trace_time_start_(0),
+  subcycle_level_min_(0),
+  subcycle_level_max_(0),
+  subcycle_cycle_(cycle),
+  field_data_old_(NULL),
+  field_data_interp_(NULL),
+  cycle_interp_(-1),
+  neighbor_list_(),
+  neighbor_list_valid_(false)
 {
   // Enable Charm++ AtSync() dynamic load balancing
   usesAtSync = CmiTrue;
@@ -218,7 +231,11 @@ Block::Block
 
   if (level > 0) {
 
-    thisProxy.doneInserting();
+    // With bulk refinement all children share the doneInserting()
+    // epoch closed in adapt_end_()
+    if (! simulation()->config()->adapt_refine_bulk) {
+      thisProxy.doneInserting();
+    }
 
     control_sync (CkIndex_Main::p_adapt_end(),sync_quiescence);
 
@@ -251,6 +268,21 @@ void Block::pup(PUP::er &p)
     child_data_ = NULL;
   }
 
+  p | subcycle_level_min_;
+  p | subcycle_level_max_;
+  p | subcycle_cycle_;
+
+  // field_data_old_ may be NULL
+  allocated=(field_data_old_ != NULL);
+  p|allocated;
+  if (allocated) {
+    if (up) field_data_old_=new FieldData;
+    p|*field_data_old_;
+  } else {
+    field_data_old_ = NULL;
+  }
+  // SKIP field_data_interp_: recomputed when needed
+
   p | index_;
   p | level_next_;
   p | cycle_;
@@ -277,6 +309,7 @@ void Block::pup(PUP::er &p)
   p | name_;
   p | refresh_;
   p | index_method_;
+  p | method_cost_;
   // SKIP method_: initialized when needed
 
   if (up) debug_faces_("PUP");
@@ -316,6 +349,36 @@ ItNeighbor Block::it_neighbor (int min_face_rank, Index index) throw()
 
 //----------------------------------------------------------------------
 
+const std::vector<Neighbor> & Block::neighbor_list() throw()
+{
+  if (! neighbor_list_valid_) {
+
+    const int rank = this->rank();
+
+    neighbor_list_.clear();
+
+    ItNeighbor it_neighbor = this->it_neighbor(0,index_);
+
+    while (it_neighbor.next()) {
+      Neighbor neighbor;
+      neighbor.index      = it_neighbor.index();
+      it_neighbor.face  (neighbor.face);
+      it_neighbor.child (neighbor.child);
+      neighbor.face_level = it_neighbor.face_level();
+      neighbor.face_rank  = rank - (std::abs(neighbor.face[0]) +
+				    std::abs(neighbor.face[1]) +
+				    std::abs(neighbor.face[2]));
+      neighbor_list_.push_back(neighbor);
+    }
+
+    neighbor_list_valid_ = true;
+  }
+
+  return neighbor_list_;
+}
+
+//----------------------------------------------------------------------
+
 Method * Block::method () throw ()
 {
   Problem * problem = simulation()->problem();
@@ -395,6 +458,22 @@ Block::~Block() throw ()
   data_ = 0;
   if (child_data_) delete child_data_;
   child_data_ = 0;
+  if (field_data_old_) delete field_data_old_;
+  field_data_old_ = 0;
+  if (field_data_interp_) delete field_data_interp_;
+  field_data_interp_ = 0;
+
+  invalidate_boundary_();
+
+  // Close the Block's current trace interval and release its
+  // timeline, whether the Block is deleted or migrating away
+
+  Trace * trace = simulation()->trace();
+  if (trace) {
+    trace_switch_(trace,perf_unknown);
+    if (trace_thread_ >= 0) trace->delete_thread(trace_thread_);
+    trace_thread_ = -1;
+  }
 
   simulation()->delete_block();
 
@@ -419,7 +498,17 @@ void Block::x_refresh_child
 
 //----------------------------------------------------------------------
 
-Block::Block (CkMigrateMessage *m) : CBase_Block(m)
+Block::Block (CkMigrateMessage *m) 
+  : CBase_Block(m),
+    time_method_start_(0),
+    trace_thread_(-1),
+    trace_region_(perf_unknown),
+    trace_time_start_(0),
+    field_data_old_(NULL),
+    field_data_interp_(NULL),
+    cycle_interp_(-1),
+    neighbor_list_(),
+    neighbor_list_valid_(false)
 { 
   simulation()->insert_block();
 };
@@ -613,6 +702,19 @@ void Block::update_boundary_ ()
 
 //----------------------------------------------------------------------
 
+void Block::invalidate_boundary_ ()
+{
+  int index = 0;
+  Problem * problem = simulation()->problem();
+  Boundary * boundary;
+
+  while ((boundary = problem->boundary(index++))) {
+    boundary->invalidate(this);
+  }
+}
+
+//----------------------------------------------------------------------
+
 void Block::periodicity (bool p32[3][2]) const
 {
   for (int axis=0; axis<3; axis++) {
@@ -635,11 +737,12 @@ FieldFace * Block::load_face
  int *   n, char ** a,
  int if3[3], int ic3[3], bool lg3[3],
  int op_array_type,
- std::vector<int> & field_list 
+ std::vector<int> & field_list,
+ FieldData * field_data
  )
 {
   FieldFace * field_face = create_face_ 
-    (if3,ic3,lg3, op_array_type,field_list);
+    (if3,ic3,lg3, op_array_type,field_list,field_data);
   field_face->load(n, a);
   return field_face;
 }
@@ -666,11 +769,12 @@ void Block::store_face_
 FieldFace * Block::create_face_
 (int if3[3], int ic3[3], bool lg3[3],
  int op_array_type,
- std::vector<int> & field_list
+ std::vector<int> & field_list,
+ FieldData * field_data
  )
 {
   Problem * problem        = simulation()->problem();
-  FieldData * field_data = data_->field_data();
+  if (field_data == NULL) field_data = data_->field_data();
 
   FieldFace * field_face = new FieldFace (field_data);
 
@@ -790,6 +894,28 @@ void Block::performance_switch_
 (int index_region, std::string file, int line)
 {
   simulation()->performance()->switch_region(index_region,file,line);
+
+  Trace * trace = simulation()->trace();
+  if (trace) trace_switch_(trace,index_region);
+}
+
+//----------------------------------------------------------------------
+
+void Block::trace_switch_ (Trace * trace, int index_region)
+{
+  if (index_region == trace_region_) return;
+
+  long long time = simulation()->performance()->time_usec();
+
+  if (trace_thread_ < 0) trace_thread_ = trace->new_thread(name_);
+
+  if (trace_region_ != perf_unknown) {
+    trace->record (trace_region_, trace_thread_,
+		   trace_time_start_, time - trace_time_start_);
+  }
+
+  trace_region_     = index_region;
+  trace_time_start_ = time;
 }
 
 //----------------------------------------------------------------------
@@ -156,7 +156,10 @@ public: // interface
   { return child_face_level_next_[ICF3(ic3,if3)]; }
 
   void set_face_level_curr (const int if3[3], int level)
-  { face_level_curr_[IF3(if3)] = level; }
+  {
+    face_level_curr_[IF3(if3)] = level;
+    neighbor_list_valid_ = false;
+  }
 
   void set_face_level_next (const int if3[3], int level)
   { face_level_next_[IF3(if3)] = level; }
@@ -201,6 +204,7 @@ public: // interface
     //    for (int i=0; i<face_level_next_.size(); i++) face_level_next_[i]=0;
     child_face_level_curr_ = child_face_level_next_;
     //    for (int i=0; i<child_face_level_next_.size(); i++) child_face_level_next_[i]=0;
+    neighbor_list_valid_ = false;
   }
 
   bool is_child_ (const Index & index) const
@@ -225,6 +229,12 @@ public: // interface
 
   ItNeighbor it_neighbor(int min_face_rank, Index index) throw();
 
+  /// Return the leaf Block's neighbors across faces of all ranks, as
+  /// from it_neighbor(0,index()).  The list is only recomputed after
+  /// face levels change, so callers skip entries with face_rank less
+  /// than their minimum face rank instead of iterating with ItNeighbor
+  const std::vector<Neighbor> & neighbor_list() throw();
+
   //--------------------------------------------------
   // Charm++ virtual
   //--------------------------------------------------
@@ -264,6 +274,10 @@ public: // interface
   void r_compute_exit(CkReductionMsg * msg)
   {      compute_exit_(); delete msg; }
 
+  /// Resume the current Method after a Reduction
+  void r_method_reduction(CkReductionMsg * msg)
+  {      method()->compute_resume (this,msg); delete msg; }
+
   /// Set the currently active Method.  Used to resume a Method's
   /// computation after a reduction
   void set_method_index (int index_method) throw()
@@ -276,6 +290,15 @@ public: // interface
   /// Return the currently-active Method
   Method * method () throw();
 
+  /// Return the time in microseconds spent computing the given Method
+  /// on this Block during the current cycle, or in all Methods if
+  /// index_method < 0.  Usable as a per-Block load estimate.
+  long long cost (int index_method = -1) const throw();
+
+  /// Clear the per-Block Method costs
+  void reset_cost () throw()
+  { method_cost_.clear(); }
+
 protected:
   /// Enter control compute phase
   void compute_enter_();
@@ -287,6 +310,8 @@ protected:
   void compute_continue_();
   /// Cleanup after all Methods have been applied
   void compute_end_();
+  /// Stop timing the current Method and add to its costs
+  void compute_cost_();
   /// Exit control compute phase
   void compute_exit_();
 public:
@@ -369,6 +394,7 @@ public:
 
 protected:
   bool do_adapt_();
+  bool adapt_initial_direct_() const;
   void adapt_enter_();
   void adapt_begin_ ();
   void adapt_next_ ();
@@ -376,6 +402,7 @@ protected:
   void adapt_exit_();
   void adapt_coarsen_();
   void adapt_refine_();
+  void adapt_refine_bulk_();
   void adapt_called_();
   int adapt_compute_desired_level_(int level_maximum);
   void adapt_delete_child_(Index index_child);
@@ -474,6 +501,10 @@ protected:
 
   void stopping_enter_();
   void stopping_begin_();
+
+  /// Contribute to the timestep and level reduction for Adapt:subcycle
+  void stopping_subcycle_();
+
   void stopping_balance_();
   void stopping_exit_();
 
@@ -500,6 +531,10 @@ protected:
   void performance_switch_
   (int index_region, std::string file="", int line=0);
 
+  /// Record the Block's previous region in the Trace, if any, and
+  /// begin timing index_region
+  void trace_switch_ (Trace * trace, int index_region);
+
   //--------------------------------------------------
   // TESTING
   //--------------------------------------------------
@@ -543,6 +578,18 @@ public: // virtual functions
   virtual void initialize () throw()
   {  }
 
+  /// Return face fluxes to append to the restricted face data sent
+  /// to a coarser neighbor across face if3; n is 0 if there are none
+  virtual void load_flux_face (int * n, char ** array, const int if3[3])
+    throw()
+  { *n = 0; *array = 0; }
+
+  /// Apply face fluxes received from finer neighbor ic3 across face
+  /// if3 to correct fluxes previously computed by this Block
+  virtual void store_flux_face (int n, char * array,
+				const int if3[3], const int ic3[3]) throw()
+  { }
+
   /// Return the local simulation object
   Simulation * simulation() const;
 
@@ -553,12 +600,14 @@ public: // virtual functions
 
   void ResumeFromSync();
 
-  /// Create the specified FieldFace and return its array a of length n
+  /// Create the specified FieldFace and return its array a of length
+  /// n, loaded from field_data if given instead of the Block's fields
   FieldFace * load_face
   (int * n, char ** a,
    int if3[3], int ic3[3], bool lg3[3],
    int op_array,
-   std::vector<int> & field_list);
+   std::vector<int> & field_list,
+   FieldData * field_data = 0);
 
 protected: // functions
 
@@ -637,6 +686,9 @@ protected: // functions
   /// Update boundary conditions
   void update_boundary_ ();
 
+  /// Discard boundary values cached for this Block
+  void invalidate_boundary_ ();
+
   /// Boundary is a boundary face
   bool is_boundary_face_(int of3[3],
 			 bool boundary[3][2],
@@ -664,7 +716,29 @@ protected: // functions
   FieldFace * create_face_
   (int if3[3], int ic3[3], bool lg3[3],
    int op_array,
-   std::vector<int> & field_list);
+   std::vector<int> & field_list,
+   FieldData * field_data = 0);
+
+  /// Return the number of cycles in the Block's timestep with
+  /// Adapt:subcycle, or 1 without
+  int subcycle_period_() const;
+
+  /// Return whether the Block begins a timestep in the current cycle
+  bool subcycle_active_() const
+  { return ((cycle_ - subcycle_cycle_) % subcycle_period_()) == 0; }
+
+  /// Return whether all levels are at the same time in the current cycle
+  bool subcycle_synchronized_() const
+  { return ((cycle_ - subcycle_cycle_) %
+	    (1 << (subcycle_level_max_ - subcycle_level_min_))) == 0; }
+
+  /// Save the fields at the start of a timestep if finer neighbors
+  /// will need them for time interpolation
+  void subcycle_save_old_();
+
+  /// Return the fields interpolated in time to the current cycle for
+  /// sending to finer neighbors, or NULL to send the current fields
+  FieldData * subcycle_field_data_();
 
   /// Set the current refresh object
   void set_refresh (Refresh * refresh) 
@@ -766,6 +840,42 @@ protected: // attributes
   /// Index of currently-active Method
   int index_method_;
 
+  /// Time in usec spent computing each Method in the current cycle
+  std::vector<long long> method_cost_;
+
+  /// Start time of the currently-active Method, or 0 if not timing
+  /// (not pup'ed since Blocks do not migrate within a Method)
+  long long time_method_start_;
+
+  /// Trace thread for this Block on the current process, or -1
+  int trace_thread_;
+
+  /// Region currently being traced for this Block
+  int trace_region_;
+
+  /// Start time of trace_region_
+  long long trace_time_start_;
+
+  /// Minimum and maximum leaf levels and the cycle when all levels
+  /// were last at the same time, for Adapt:subcycle
+  int subcycle_level_min_;
+  int subcycle_level_max_;
+  int subcycle_cycle_;
+
+  /// Fields at the start of the Block's current timestep, or NULL if
+  /// not needed by finer neighbors
+  FieldData * field_data_old_;
+
+  /// Fields interpolated in time for cycle cycle_interp_ (not pup'ed)
+  FieldData * field_data_interp_;
+  int cycle_interp_;
+
+  /// Cached list of neighbors returned by neighbor_list() (not pup'ed)
+  std::vector<Neighbor> neighbor_list_;
+
+  /// Whether neighbor_list_ is consistent with face_level_curr_
+  bool neighbor_list_valid_;
+
   /// Refresh object associated with current refresh operation
   /// (Not a pointer since must be one per Block for synchronization counters)
   Refresh refresh_;
@@ -48,7 +48,8 @@ CProxy_Block Factory::create_block_array
  int nbx, int nby, int nbz,
  int nx, int ny, int nz,
  int num_field_data,
- bool testing
+ bool testing,
+ bool insert_blocks
  ) const throw()
 {
   TRACE7("Factory::create_block_array(na(%d %d %d) n(%d %d %d num_field_data %d",
@@ -67,6 +68,8 @@ CProxy_Block Factory::create_block_array
   opts.setMap(array_map);
   proxy_block = CProxy_Block::ckNew(opts);
 
+  if (! insert_blocks) return proxy_block;
+
   int count_adapt;
 
   int    cycle = 0;
@@ -168,6 +171,85 @@ void Factory::create_subblock_array
 
 //----------------------------------------------------------------------
 
+void Factory::insert_block_array_local
+(CProxy_Block * block_array,
+ int min_level,
+ int nbx, int nby, int nbz,
+ int nx, int ny, int nz,
+ int num_field_blocks,
+ bool testing
+ ) const throw()
+{
+  TRACE8("Factory::insert_block_array_local(min_level %d na(%d %d %d) n(%d %d %d) num_field_blocks %d",
+	 min_level,nbx,nby,nbz,nx,ny,nz,num_field_blocks);
+
+  // Home processes are given by the Block array's ArrayMap, so every
+  // process agrees on which process inserts which Block
+
+  CkLocMgr * loc_mgr = block_array->ckLocMgr();
+
+  const int ip = CkMyPe();
+
+  for (int level = 0; level >= min_level; level--) {
+
+    if (level < 0) {
+      if (nbx > 1) nbx = ceil(0.5*nbx);
+      if (nby > 1) nby = ceil(0.5*nby);
+      if (nbz > 1) nbz = ceil(0.5*nbz);
+    }
+
+    for (int ix=0; ix<nbx; ix++) {
+      for (int iy=0; iy<nby; iy++) {
+	for (int iz=0; iz<nbz; iz++) {
+
+	  Index index(ix,iy,iz);
+
+	  index.set_level(level);
+
+	  if (loc_mgr->homePe(CkArrayIndexIndex(index)) != ip) continue;
+
+	  TRACE4 ("inserting %d %d %d level %d",ix,iy,iz,level);
+
+	  insert_block_ (block_array,index,nx,ny,nz,num_field_blocks,testing);
+
+	}
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Factory::insert_block_
+(CProxy_Block * block_array,
+ Index index,
+ int nx, int ny, int nz,
+ int num_field_blocks,
+ bool testing
+ ) const throw()
+{
+  int count_adapt;
+
+  int    cycle = 0;
+  double time  = 0.0;
+  double dt    = 0.0;
+  int num_face_level = 0;
+  int * face_level = 0;
+
+  (*block_array)[index].insert
+    (index,
+     nx,ny,nz,
+     num_field_blocks,
+     count_adapt = 0,
+     cycle, time, dt,
+     0,NULL,op_array_copy,
+     num_face_level, face_level,
+     testing);
+  // --------------------------------------------------
+}
+
+//----------------------------------------------------------------------
+
 Block * Factory::create_block
 (
  CProxy_Block * block_array,
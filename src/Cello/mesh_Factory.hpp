@@ -48,13 +48,16 @@ public: // interface
   /// Create an Input / Output accessor object for a FieldData
   virtual IoFieldData * create_io_field_data ( ) const throw();
 
-  /// Create a new CHARM++ Block array
+  /// Create a new CHARM++ Block array.  If insert_blocks is false
+  /// the array is created empty, and Blocks are added later using
+  /// insert_block_array_local() on each process
   virtual CProxy_Block create_block_array
   (
    int nbx, int nby, int nbz,
    int nx, int ny, int nz,
    int num_field_blocks,
-   bool testing = false) const throw();
+   bool testing = false,
+   bool insert_blocks = true) const throw();
 
   /// Create a new coarse blocks under the Block array.  For Multigrid
   ///  solvers.  Arguments are the same as create_block_array(), plus
@@ -67,6 +70,17 @@ public: // interface
    int num_field_blocks,
    bool testing=false) const throw();
 
+  /// Insert the root-level Blocks, and sub-root Blocks down to
+  /// min_level <= 0, that the Block array's ArrayMap assigns to this
+  /// process.  Arguments are the same as create_subblock_array()
+  virtual void insert_block_array_local
+  (CProxy_Block * block_array,
+   int min_level,
+   int nbx, int nby, int nbz,
+   int nx, int ny, int nz,
+   int num_field_blocks,
+   bool testing=false) const throw();
+
   /// Create a new Block
   virtual Block * create_block
   (
@@ -81,6 +95,17 @@ public: // interface
    bool testing = false,
    Simulation * simulation = 0) const throw();
 
+protected: // functions
+
+  /// Insert the root or sub-root Block at index into the Block
+  /// array; overridden to insert Blocks of a derived type
+  virtual void insert_block_
+  (CProxy_Block * block_array,
+   Index index,
+   int nx, int ny, int nz,
+   int num_field_blocks,
+   bool testing) const throw();
+
 };
 
 #endif /* MESH_FACTORY_HPP */
@@ -64,7 +64,8 @@ void Hierarchy::pup (PUP::er &p)
 
   if (up) num_blocks_ = 0;
 
-  // block_array_ is NULL on non-root processes
+  // block_array_ is NULL on non-root processes unless set by
+  // set_block_array()
   bool allocated=(block_array_ != NULL);
   p|allocated;
   if (allocated) {
@@ -197,7 +198,8 @@ void Hierarchy::create_forest
 (
  FieldDescr   * field_descr,
  bool allocate_data,
- bool testing) throw()
+ bool testing,
+ bool insert_blocks) throw()
 {
   // determine block size
   const int mbx = root_size_[0] / blocking_[0];
@@ -233,7 +235,8 @@ void Hierarchy::create_forest
     (blocking_[0],blocking_[1],blocking_[2],
      mbx,mby,mbz,
      num_field_blocks,
-     testing);
+     testing,
+     insert_blocks);
     
   block_exists_ = allocate_data;
 
@@ -269,3 +272,39 @@ void Hierarchy::create_subforest
     
 }
 
+//----------------------------------------------------------------------
+
+void Hierarchy::set_block_array (CProxy_Block block_array) throw()
+{
+  if (block_array_ == NULL) block_array_ = new CProxy_Block;
+
+  (*block_array_) = block_array;
+}
+
+//----------------------------------------------------------------------
+
+void Hierarchy::insert_forest_local
+(
+ int min_level,
+ bool testing) throw()
+{
+  ASSERT("Hierarchy::insert_forest_local()",
+	 "Block array must be created before inserting Blocks",
+	 block_array_ != NULL);
+
+  // determine block size
+
+  const int mbx = root_size_[0] / blocking_[0];
+  const int mby = root_size_[1] / blocking_[1];
+  const int mbz = root_size_[2] / blocking_[2];
+
+  int num_field_blocks = 1;
+
+  factory_->insert_block_array_local
+    (block_array_,MIN(min_level,0),
+     blocking_[0],blocking_[1],blocking_[2],
+     mbx,mby,mbz,
+     num_field_blocks,
+     testing);
+}
+
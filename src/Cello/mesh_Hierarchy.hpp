@@ -121,13 +121,23 @@ public: // interface
 
   void create_forest (FieldDescr   * field_descr,
 		      bool allocate_data,
-		      bool testing          = false) throw();
+		      bool testing          = false,
+		      bool insert_blocks    = true) throw();
 
   void create_subforest (FieldDescr   * field_descr,
 			 bool allocate_data,
 			 int min_level,
 			 bool testing          = false) throw();
 
+  /// Use the given Block array created on the root process, which
+  /// remains responsible for destroying it
+  void set_block_array (CProxy_Block block_array) throw();
+
+  /// Insert this process's root and sub-root Blocks into the Block
+  /// array created by create_forest() with insert_blocks = false
+  void insert_forest_local (int min_level,
+			    bool testing          = false) throw();
+
 
   /// Return the number of Blocks along each rank
   void blocking (int * nbx, int * nby=0, int * nbz=0) const throw();
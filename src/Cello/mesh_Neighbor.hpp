@@ -0,0 +1,33 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     mesh_Neighbor.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Mesh] Declaration of the Neighbor struct
+
+#ifndef MESH_NEIGHBOR_HPP
+#define MESH_NEIGHBOR_HPP
+
+/// @struct   Neighbor
+/// @brief    [\ref Mesh] A leaf Block's neighbor as returned by
+/// ItNeighbor, saved in the Block's neighbor list
+struct Neighbor {
+
+  /// Index of the neighboring Block
+  Index index;
+
+  /// Face shared with the neighbor, as returned by ItNeighbor::face()
+  int face[3];
+
+  /// Child indices, as returned by ItNeighbor::child()
+  int child[3];
+
+  /// Level of the neighbor, which differs by at most one from the Block's
+  int face_level;
+
+  /// Rank of the shared face: rank-1 for faces down to 0 for corners
+  int face_rank;
+
+};
+
+#endif /* MESH_NEIGHBOR_HPP */
@@ -56,6 +56,9 @@ public: // interface
 
   virtual std::string name () const { return "unknown"; }
 
+  /// Return the name of the output field, or "" if none
+  std::string output () const { return output_; }
+
   void * initialize_output_(FieldData * field_data);
 
 protected:
@@ -87,12 +87,13 @@ int RefineMass::apply
       float * array  = (float*)void_array;
       float * output = (float*)void_output;
       float mass;
-      for (int axis=0; axis<3; axis++) {
-	int d = d3[axis];
-	for (int ix=0; ix<nx; ix++) {
-	  for (int iy=0; iy<ny; iy++) {
-	    for (int iz=0; iz<nz; iz++) {
-	      int i = (gx+ix) + nx*((gy+iy) + ny*(gz+iz));
+      // Stop after any row that refines unless output is needed
+      for (int iz=0; iz<nz && ! (any_refine && ! output); iz++) {
+	for (int iy=0; iy<ny && ! (any_refine && ! output); iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int i = (gx+ix) + nx*((gy+iy) + ny*(gz+iz));
+	    for (int axis=0; axis<3; axis++) {
+	      int d = d3[axis];
 	      mass = (array[i]) ? (array[i+d] - array[i-d]) / array[i] : 0.0;
 	      if (mass > mass_min_refine)  any_refine  = true;
 	      if (mass > mass_max_coarsen) all_coarsen = false;
@@ -112,12 +113,13 @@ int RefineMass::apply
       double * output = (double*)void_output;
       double mass;
 
-      for (int axis=0; axis<3; axis++) {
-	int d = d3[axis];
-	for (int ix=0; ix<nx; ix++) {
-	  for (int iy=0; iy<ny; iy++) {
-	    for (int iz=0; iz<nz; iz++) {
-	      int i = (gx+ix) + nx*((gy+iy) + ny*(gz+iz));
+      // Stop after any row that refines unless output is needed
+      for (int iz=0; iz<nz && ! (any_refine && ! output); iz++) {
+	for (int iy=0; iy<ny && ! (any_refine && ! output); iy++) {
+	  for (int ix=0; ix<nx; ix++) {
+	    int i = (gx+ix) + nx*((gy+iy) + ny*(gz+iz));
+	    for (int axis=0; axis<3; axis++) {
+	      int d = d3[axis];
 	      mass = (array[i]) ? (array[i+d] - array[i-d]) / array[i] : 0.0;
 	      if (mass > mass_min_refine)  any_refine  = true;
 	      if (mass > mass_max_coarsen) all_coarsen = false;
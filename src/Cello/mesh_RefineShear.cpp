@@ -121,6 +121,9 @@ void RefineShear::evaluate_block_(const T * u,
   // Compute inner-product of shear vector.  Note works for
   // rank = 1, 2, 3 since 
 
+  bool refine  = *any_refine;
+  bool coarsen = *all_coarsen;
+
   for (int iz=gz; iz<nz+gz; iz++) {
     for (int iy=gy; iy<ny+gy; iy++) {
       for (int ix=gx; ix<nx+gx; ix++) {
@@ -136,15 +139,24 @@ void RefineShear::evaluate_block_(const T * u,
 	  wy = w[i+ky] - w[i-ky]; wy *= wy;
 	}
 	shear = uy + uz + vx + vz + wx + wy;
-	if (shear > min_refine_)  *any_refine  = true;
-	if (shear > max_coarsen_) *all_coarsen = false;
+	if (shear > min_refine_)  refine  = true;
+	if (shear > max_coarsen_) coarsen = false;
 	if (output) {
 	  if (shear > max_coarsen_) output[i] =  0;
 	  if (shear > min_refine_)  output[i] = +1;
 	}
       }
+      // Remaining cells cannot change the result once refining
+      if (refine && ! output) {
+	*any_refine  = true;
+	*all_coarsen = false;
+	return;
+      }
     }
   }
+
+  *any_refine  = refine;
+  *all_coarsen = coarsen;
 }
 //======================================================================
 
@@ -61,6 +61,10 @@ int RefineSlope::apply
 
   for (size_t k=0; k<field_id_list_.size(); k++) {
 
+    // Remaining fields cannot change the result once refining
+
+    if (any_refine && ! output) break;
+
     int id_field = field_id_list_[k];
 
     int gx,gy,gz;
@@ -124,25 +128,40 @@ void RefineSlope::evaluate_block_(T * array, T * output ,
   // TEMPORARY: evaluate effect of including (some) ghost zones
   T slope;
   const int d3[3] = {1,ndx,ndx*ndy};
-  for (int axis=0; axis<rank; axis++) {
-    int id = d3[axis];
-    const int i0 = gx + ndx*(gy + ndy*gz);
-    for (int ix=0; ix<nx; ix++) {
-      for (int iy=0; iy<ny; iy++) {
-	for (int iz=0; iz<nz; iz++) {
-	  int i = i0 + ix + ndx*(iy + ndy*iz);
+  const int i0 = gx + ndx*(gy + ndy*gz);
+
+  // Single unit-stride pass over the block for all axes, returning
+  // after any row that refines unless the output field is needed
+
+  bool refine  = *any_refine;
+  bool coarsen = *all_coarsen;
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	int i = i0 + ix + ndx*(iy + ndy*iz);
+	for (int axis=0; axis<rank; axis++) {
+	  int id = d3[axis];
 	  slope = fabs( (array[i+id] - array[i-id]) 
 		       / (2.0*h3[axis]*array[i]));
-	  if (slope > min_refine_)  *any_refine  = true;
-	  if (slope > max_coarsen_) *all_coarsen = false;
+	  if (slope > min_refine_)  refine  = true;
+	  if (slope > max_coarsen_) coarsen = false;
 	  if (output) {
 	    if (slope > max_coarsen_) output[i] =  0;
 	    if (slope > min_refine_)  output[i] = +1;
 	  }
 	}
       }
+      if (refine && ! output) {
+	*any_refine  = true;
+	*all_coarsen = false;
+	return;
+      }
     }
   }
+
+  *any_refine  = refine;
+  *all_coarsen = coarsen;
 }
 //======================================================================
 
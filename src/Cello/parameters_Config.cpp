@@ -60,17 +60,23 @@ void Config::pup (PUP::er &p)
   // Memory
 
   p | memory_active;
+  p | memory_fill;
+  p | memory_sample_interval;
 
   // Mesh
 
   PUParray(p,mesh_root_blocks,3);
   p | mesh_root_rank;
   PUParray(p,mesh_root_size,3);
+  p | mesh_distributed_insert;
   p | mesh_max_level;
   p | mesh_min_level;
   p | mesh_adapt_interval;
   p | num_mesh;
   p | adapt_min_face_rank;
+  p | adapt_refine_bulk;
+  p | adapt_initial_direct;
+  p | adapt_subcycle;
   PUParray(p,mesh_list,MAX_MESH_GROUPS);
   PUParray(p,mesh_type,MAX_MESH_GROUPS);
   PUParray(p,mesh_field_list,MAX_MESH_GROUPS);
@@ -109,6 +115,14 @@ void Config::pup (PUP::er &p)
   PUParray (p,output_image_specify_bounds,MAX_OUTPUT_GROUPS);
   PUParray (p,output_image_min,MAX_OUTPUT_GROUPS);
   PUParray (p,output_image_max,MAX_OUTPUT_GROUPS);
+  PUParray (p,output_analysis_list,MAX_OUTPUT_GROUPS);
+  PUParray (p,output_analysis_histogram_bins,MAX_OUTPUT_GROUPS);
+  PUParray (p,output_analysis_histogram_min,MAX_OUTPUT_GROUPS);
+  PUParray (p,output_analysis_histogram_max,MAX_OUTPUT_GROUPS);
+  PUParray (p,output_analysis_histogram_log,MAX_OUTPUT_GROUPS);
+  PUParray (p,output_analysis_spectrum_kmax,MAX_OUTPUT_GROUPS);
+  PUParray (p,output_analysis_weight_field,MAX_OUTPUT_GROUPS);
+  PUParray (p,output_analysis_conserved_tolerance,MAX_OUTPUT_GROUPS);
   PUParray (p,output_schedule_index,MAX_OUTPUT_GROUPS);
   PUParray (p,output_field_list,MAX_OUTPUT_GROUPS);
   PUParray (p,output_stride,MAX_OUTPUT_GROUPS);
@@ -129,6 +143,9 @@ void Config::pup (PUP::er &p)
   p | performance_name;
   p | performance_stride;
   p | performance_warnings;
+  p | performance_trace_name;
+  p | performance_trace_interval;
+  p | performance_trace_size;
 
   // Restart
 
@@ -422,6 +439,17 @@ void Config::read_initial_ (Parameters * p) throw()
   initial_type  = p->value_string ("Initial:type","value");
   initial_time  = p->value_float  ("Initial:time",0.0);
 
+  // Initial conditions read from files cannot be evaluated on new
+  // refined Blocks
+
+  if (adapt_initial_direct && 
+      (initial_type == "file" || initial_type == "checkpoint")) {
+    WARNING1 ("Config::read_initial_()",
+	      "Ignoring Adapt:initial_direct for Initial:type \"%s\"",
+	      initial_type.c_str());
+    adapt_initial_direct = false;
+  }
+
   //  initial_name;
 
   //  initial_value
@@ -438,6 +466,17 @@ void Config::read_memory_ (Parameters * p) throw()
 
   memory_active = p->value_logical("Memory:active",true);
 
+  // Whether to fill memory with a pattern after allocating and before
+  // deallocating to catch uninitialized and dangling accesses; turn
+  // off in production runs
+
+  memory_fill = p->value_logical("Memory:fill",true);
+
+  // Allocations per thread between samples of the allocation site,
+  // or 0 for no sampling
+
+  memory_sample_interval = p->value_integer("Memory:sample_interval",0);
+
 }
 
 //----------------------------------------------------------------------
@@ -474,6 +513,13 @@ void Config::read_mesh_ (Parameters * p) throw()
   mesh_root_size[1] = p->list_value_integer(1,"Mesh:root_size",1);
   mesh_root_size[2] = p->list_value_integer(2,"Mesh:root_size",1);
 
+  //--------------------------------------------------
+
+  // Whether each process inserts its own root and sub-root Blocks
+  // instead of the root process inserting all of them
+
+  mesh_distributed_insert = p->value_logical("Mesh:distributed_insert",false);
+
 }
 
 //----------------------------------------------------------------------
@@ -496,6 +542,28 @@ void Config::read_adapt_ (Parameters * p) throw()
 
   //--------------------------------------------------
 
+  // Whether to insert all children of a refining Block in a single
+  // pass using one shared send buffer and a single doneInserting()
+
+  adapt_refine_bulk = p->value_logical("Adapt:refine_bulk",false);
+
+  //--------------------------------------------------
+
+  // Whether to refine the initial mesh by initializing new Blocks
+  // directly from the Initial conditions, without prolonging data,
+  // stopping as soon as an adapt step refines no Blocks
+
+  adapt_initial_direct = p->value_logical("Adapt:initial_direct",false);
+
+  //--------------------------------------------------
+
+  // Whether each level advances with its own timestep, 2^k times that
+  // of the finest level for Blocks k levels coarser
+
+  adapt_subcycle = p->value_logical("Adapt:subcycle",false);
+
+  //--------------------------------------------------
+
   num_mesh = p->list_length("Adapt:list");
 
   for (int ia=0; ia<num_mesh; ia++) {
@@ -726,6 +794,41 @@ void Config::read_output_ (Parameters * p) throw()
       }
 
     }
+
+    // Analysis
+
+    if (output_type[index_output] == "analysis") {
+
+      if (p->type("analysis_list") == parameter_list) {
+	int size = p->list_length("analysis_list");
+	output_analysis_list[index_output].resize(size);
+	for (int i=0; i<size; i++) {
+	  output_analysis_list[index_output][i] = 
+	    p->list_value_string(i,"analysis_list","");
+	}
+      } else {
+	output_analysis_list[index_output].push_back("sum");
+	output_analysis_list[index_output].push_back("mean");
+	output_analysis_list[index_output].push_back("min");
+	output_analysis_list[index_output].push_back("max");
+      }
+
+      output_analysis_histogram_bins[index_output] =
+	p->value_integer("analysis_histogram_bins",32);
+      output_analysis_histogram_min[index_output] =
+	p->value_float("analysis_histogram_min",0.0);
+      output_analysis_histogram_max[index_output] =
+	p->value_float("analysis_histogram_max",1.0);
+      output_analysis_histogram_log[index_output] =
+	p->value_logical("analysis_histogram_log",false);
+      output_analysis_spectrum_kmax[index_output] =
+	p->value_integer("analysis_spectrum_kmax",8);
+      output_analysis_weight_field[index_output] =
+	p->value_string("analysis_weight_field","");
+      output_analysis_conserved_tolerance[index_output] =
+	p->value_float("analysis_conserved_tolerance",0.0);
+
+    }
   }  
 
 }
@@ -749,6 +852,13 @@ void Config::read_performance_ (Parameters * p) throw()
   performance_stride   = p->value_integer("Performance:stride",1);
   performance_warnings = p->value_logical("Performance:warnings",true);
 
+  performance_trace_name     = p->value_string 
+    ("Performance:trace:name","");
+  performance_trace_interval = p->value_integer
+    ("Performance:trace:interval",1);
+  performance_trace_size     = p->value_integer
+    ("Performance:trace:size",65536);
+
 }
 
 //----------------------------------------------------------------------
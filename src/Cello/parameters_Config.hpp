@@ -103,17 +103,23 @@ public: // attributes
   // Memory
 
   bool                       memory_active;
+  bool                       memory_fill;
+  int                        memory_sample_interval;
 
   // Mesh
 
   int                        mesh_root_blocks[3];
   int                        mesh_root_rank;
   int                        mesh_root_size[3];
+  bool                       mesh_distributed_insert;
   int                        mesh_min_level;
   int                        mesh_max_level;
   int                        mesh_adapt_interval;
   int                        num_mesh;
   int                        adapt_min_face_rank;
+  bool                       adapt_refine_bulk;
+  bool                       adapt_initial_direct;
+  bool                       adapt_subcycle;
   std::string                mesh_list[MAX_MESH_GROUPS];
   std::string                mesh_type[MAX_MESH_GROUPS];
   std::vector<std::string>   mesh_field_list[MAX_MESH_GROUPS];
@@ -152,6 +158,14 @@ public: // attributes
   bool                       output_image_specify_bounds [MAX_OUTPUT_GROUPS];
   double                     output_image_min            [MAX_OUTPUT_GROUPS];
   double                     output_image_max            [MAX_OUTPUT_GROUPS];
+  std::vector<std::string>   output_analysis_list        [MAX_OUTPUT_GROUPS];
+  int                        output_analysis_histogram_bins [MAX_OUTPUT_GROUPS];
+  double                     output_analysis_histogram_min  [MAX_OUTPUT_GROUPS];
+  double                     output_analysis_histogram_max  [MAX_OUTPUT_GROUPS];
+  bool                       output_analysis_histogram_log  [MAX_OUTPUT_GROUPS];
+  int                        output_analysis_spectrum_kmax  [MAX_OUTPUT_GROUPS];
+  std::string                output_analysis_weight_field   [MAX_OUTPUT_GROUPS];
+  double                     output_analysis_conserved_tolerance [MAX_OUTPUT_GROUPS];
   int                        output_schedule_index [MAX_OUTPUT_GROUPS];
   std::vector<std::string>   output_dir            [MAX_OUTPUT_GROUPS];
   int                        output_stride         [MAX_OUTPUT_GROUPS];
@@ -172,6 +186,9 @@ public: // attributes
   std::string                performance_name;
   int                        performance_stride;
   bool                       performance_warnings;
+  std::string                performance_trace_name;
+  int                        performance_trace_interval;
+  int                        performance_trace_size;
 
   // Restart
 
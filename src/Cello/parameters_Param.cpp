@@ -363,6 +363,32 @@ void Param::dealloc_list_ (list_type * value)
 
 //----------------------------------------------------------------------
 
+bool Param::depends_on (char variable) const
+{
+  if (type_ != parameter_float_expr &&
+      type_ != parameter_logical_expr) return false;
+
+  return node_depends_on_(value_expr_,variable);
+}
+
+//----------------------------------------------------------------------
+
+bool Param::node_depends_on_
+(const struct node_expr * node, char variable)
+/// @param node Head node of the expression tree to search
+/// @param variable Variable name, e.g. 't'
+{
+  if (node == NULL) return false;
+
+  if (node->type == enum_node_variable && node->var_value == variable)
+    return true;
+
+  return (node_depends_on_(node->left,variable) ||
+	  node_depends_on_(node->right,variable));
+}
+
+//----------------------------------------------------------------------
+
 void Param::dealloc_node_expr_ (struct node_expr * p)
 /// @param p Head node of the tree defining the floating-point 
 /// expression to deallocate
@@ -111,6 +111,10 @@ public: // interface
     double             t,
     struct node_expr * node = 0);
 
+  /// Return whether an expression parameter depends on the given
+  /// variable 'x', 'y', 'z' or 't'
+  bool depends_on (char variable) const;
+
   /// Set the parameter type and value
   void set(struct param_struct * param);
 
@@ -223,6 +227,10 @@ private: // functions
   /// Deallocate an expression parameter
   void dealloc_node_expr_ (struct node_expr * p);
 
+  /// Return whether an expression tree contains the given variable
+  static bool node_depends_on_ (const struct node_expr * node,
+				char variable);
+
   ///
   void write_float_expr_(FILE * file_pointer,
 			  struct node_expr * value_expr_);
@@ -176,9 +176,15 @@ Performance::new_region (int         region_index,
   region_name_[region_index] = region_name;
   region_index_[region_name]  = region_index;
 
-  std::vector <long long> counters;
-  region_counters_.push_back(counters);
-  region_started_.push_back(false);
+  // Regions may be added after begin(), so size any new counters here
+
+  const int nr = region_name_.size();
+  const int nc = num_counters();
+  region_counters_.resize(nr);
+  region_started_.resize(nr,false);
+  if (region_counters_[region_index].size() == 0) {
+    region_counters_[region_index].resize(nc,0);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -313,5 +319,25 @@ Performance::region_counters(int index_region, long long * counters) throw()
   }
 }
 
+//----------------------------------------------------------------------
+
+void
+Performance::increment_region_counter
+(int index_region, int index_counter, long long value) throw()
+{
+  if (region_started_[index_region]) {
+    if (warnings_) {
+      WARNING1 ("Performance::increment_region_counter",
+		"Region %s is active",
+		region_name_[index_region].c_str());
+    }
+    return;
+  }
+
+  if (counter_type(index_counter) != counter_type_abs) {
+    region_counters_[index_region][index_counter] += value;
+  }
+}
+
 //======================================================================
 
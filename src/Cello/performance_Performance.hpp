@@ -42,6 +42,8 @@ enum perf_region {
   perf_stopping,
   perf_last
 };
+// Regions for individual Methods and their Refresh operations are
+// appended after perf_last by Simulation
 
 class Performance {
 
@@ -164,6 +166,15 @@ public: // interface
   /// Return counters for a code region
   void region_counters(int index_region, long long * counters) throw();
 
+  /// Add a value to a relative counter of a stopped region, for
+  /// code sections timed outside of start_region() / stop_region()
+  void increment_region_counter
+  (int index_region, int index_counter, long long value) throw();
+
+  /// Return the current time in usec
+  long long time_usec () const throw()
+  { return time_real_(); }
+
   /// Return whether the given region is active
   bool region_started(int index_region) const throw()
   { return region_started_[index_region]; }
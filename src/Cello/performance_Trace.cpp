@@ -0,0 +1,121 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file      performance_Trace.cpp
+/// @author    James Bordner (jobordner@ucsd.edu)
+/// @date      2026-10-19
+/// @brief     Implementation of the Trace event recorder
+
+#include "cello.hpp"
+
+#include "performance.hpp"
+
+//----------------------------------------------------------------------
+
+Trace::Trace (std::string file_name, int capacity, int process) throw()
+  : file_name_(file_name),
+    process_(process),
+    events_(MAX(capacity,1)),
+    head_(0),
+    count_(0),
+    num_dropped_(0),
+    thread_name_(),
+    thread_free_(),
+    thread_unnamed_(),
+    file_started_(false)
+{
+}
+
+//----------------------------------------------------------------------
+
+void Trace::pup (PUP::er &p)
+{
+  // NOTE: change this function whenever attributes change
+
+  TRACEPUP;
+
+  const bool up = p.isUnpacking();
+
+  // Events are not checkpointed, but the file state is, so that a
+  // restarted run appends to the trace file instead of replacing it
+
+  p | file_name_;
+  p | process_;
+  int capacity = events_.size();
+  p | capacity;
+  p | thread_name_;
+  p | file_started_;
+
+  if (up) {
+    events_.resize(capacity);
+    head_        = 0;
+    count_       = 0;
+    num_dropped_ = 0;
+
+    // Blocks do not keep their thread ids across a restart
+
+    thread_free_.clear();
+    for (int it = thread_name_.size() - 1; it >= 0; it--) {
+      thread_free_.push_back(it);
+    }
+    thread_unnamed_.clear();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Trace::flush (const Performance * performance) throw()
+{
+  if (count_ == 0 && thread_unnamed_.size() == 0) return;
+
+  FILE * fp = fopen (file_name_.c_str(), file_started_ ? "a" : "w");
+
+  if (fp == NULL) {
+    WARNING1 ("Trace::flush",
+	      "Cannot open trace file %s",file_name_.c_str());
+    return;
+  }
+
+  if (! file_started_) {
+    fprintf (fp,"[\n");
+    fprintf (fp,"{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,"
+	     "\"args\":{\"name\":\"process %d\"}},\n",process_,process_);
+    file_started_ = true;
+  }
+
+  // Name any threads created or reused since the last flush
+
+  for (size_t i = 0; i < thread_unnamed_.size(); i++) {
+    const int it = thread_unnamed_[i];
+    fprintf (fp,"{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,"
+	     "\"tid\":%d,\"args\":{\"name\":\"%s\"}},\n",
+	     process_,it,thread_name_[it].c_str());
+  }
+  thread_unnamed_.clear();
+
+  // Write events oldest first
+
+  const int capacity = events_.size();
+  const int first = (head_ - count_ + capacity) % capacity;
+
+  for (int i = 0; i < count_; i++) {
+    const TraceEvent & event = events_[(first + i) % capacity];
+    fprintf (fp,"{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%lld,\"dur\":%lld,"
+	     "\"pid\":%d,\"tid\":%d},\n",
+	     performance->region_name(event.region).c_str(),
+	     event.time, event.duration, process_, event.thread);
+  }
+
+  fclose (fp);
+
+  if (num_dropped_ > 0) {
+    WARNING2 ("Trace::flush",
+	      "%lld events overwritten in %s: increase Performance:trace:size",
+	      num_dropped_,file_name_.c_str());
+  }
+
+  head_        = 0;
+  count_       = 0;
+  num_dropped_ = 0;
+}
+
+//======================================================================
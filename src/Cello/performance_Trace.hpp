@@ -0,0 +1,146 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Trace.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Performance] Declaration of the Trace event recorder
+
+#ifndef PERFORMANCE_TRACE_HPP
+#define PERFORMANCE_TRACE_HPP
+
+class Performance;
+
+/// @struct   TraceEvent
+/// @brief    A timed interval of a Performance region on one trace thread
+struct TraceEvent {
+  long long time;
+  long long duration;
+  int region;
+  int thread;
+};
+
+class Trace {
+
+  /// @class    Trace
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Record per-process timelines of
+  /// Performance regions and write them in Chrome trace JSON format
+  ///
+  /// Events are stored in a fixed-size ring buffer owned by a single
+  /// process, so recording needs no locking; if the buffer fills
+  /// before flush() is called the oldest events are overwritten.
+  /// Each flush() appends to the process's file, which is a valid
+  /// Chrome trace "JSON array" file on its own; use
+  /// tools/trace-merge.py to combine files from all processes.
+  ///
+  /// Thread ids freed by delete_thread() are reused by the next
+  /// new_thread(), so a timeline may show several Blocks in turn,
+  /// labelled with the most recent one.
+
+public: // interface
+
+  /// Create an inactive Trace object
+  Trace() throw()
+    : file_name_(""),
+      process_(0),
+      events_(),
+      head_(0),
+      count_(0),
+      num_dropped_(0),
+      thread_name_(),
+      thread_free_(),
+      thread_unnamed_(),
+      file_started_(false)
+  { }
+
+  /// Create a Trace object holding up to capacity events
+  Trace(std::string file_name, int capacity, int process) throw();
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Return a thread (timeline) id for the given name, reusing a
+  /// deleted thread's id if any
+  int new_thread (std::string name) throw()
+  {
+    int thread;
+    if (thread_free_.size() > 0) {
+      thread = thread_free_.back();
+      thread_free_.pop_back();
+      thread_name_[thread] = name;
+    } else {
+      thread = thread_name_.size();
+      thread_name_.push_back(name);
+    }
+    thread_unnamed_.push_back(thread);
+    return thread;
+  }
+
+  /// Release a thread id for reuse
+  void delete_thread (int thread) throw()
+  { thread_free_.push_back(thread); }
+
+  /// Return the number of thread ids allocated, including deleted ones
+  int num_threads() const throw()
+  { return thread_name_.size(); }
+
+  /// Record an interval of a region on a thread, in usec
+  inline void record
+  (int region, int thread, long long time, long long duration) throw()
+  {
+    const int capacity = events_.size();
+    if (capacity == 0) return;
+    TraceEvent & event = events_[head_];
+    event.time     = time;
+    event.duration = duration;
+    event.region   = region;
+    event.thread   = thread;
+    head_ = (head_ + 1) % capacity;
+    if (count_ < capacity) ++count_; else ++num_dropped_;
+  }
+
+  /// Return the number of events currently stored
+  int num_events() const throw()
+  { return count_; }
+
+  /// Return the number of events overwritten since the last flush()
+  long long num_dropped() const throw()
+  { return num_dropped_; }
+
+  /// Append stored events to the trace file and clear the buffer
+  void flush (const Performance * performance) throw();
+
+private: // attributes
+
+  /// Name of the trace file for this process
+  std::string file_name_;
+
+  /// Process rank, used as the trace "pid"
+  int process_;
+
+  /// Ring buffer of events
+  std::vector<TraceEvent> events_;
+
+  /// Index of the next event to write
+  int head_;
+
+  /// Number of valid events in the buffer
+  int count_;
+
+  /// Number of events overwritten before being flushed
+  long long num_dropped_;
+
+  /// Names of threads, written as trace metadata
+  std::vector<std::string> thread_name_;
+
+  /// Deleted thread ids available for reuse
+  std::vector<int> thread_free_;
+
+  /// Threads whose names have not been written since they were created
+  std::vector<int> thread_unnamed_;
+
+  /// Whether the file has been created
+  bool file_started_;
+};
+
+#endif /* PERFORMANCE_TRACE_HPP */
@@ -72,6 +72,11 @@ public: // virtual functions
 			face_enum face = face_all,
 			axis_enum axis = axis_all) const throw() = 0;
 
+  /// Discard any values cached for the Block, which is called when
+  /// the Block is refined or deleted
+  virtual void invalidate (Block * block) const throw()
+  { }
+
   /// Return which faces are periodic
   void periodicity(bool p32[3][2]) const throw() {
     for (int axis=0; axis<3; axis++) {
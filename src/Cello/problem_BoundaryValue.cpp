@@ -31,13 +31,17 @@ void BoundaryValue::enforce
 	    "Function called with ghosts not allocated");
     }
 
-    double xm,ym,zm;
-    double xp,yp,zp;
-    data -> lower(&xm,&ym,&zm);
-    data -> upper(&xp,&yp,&zp);
-
     double t = block->time();
 
+    // Time-independent values are evaluated once per Block face
+
+    std::vector<FaceValues> * block_cache = NULL;
+
+    if (is_cached_()) {
+      block_cache = &cache_[block->name()];
+      if (block_cache->size() == 0) block_cache->resize(6*field_list_.size());
+    }
+
     for (size_t index = 0; index < field_list_.size(); index++) {
 
       int nx,ny,nz;
@@ -47,20 +51,11 @@ void BoundaryValue::enforce
       int gx,gy,gz;
       field.ghost_depth(index_field,&gx,&gy,&gz);
 
-
       int ndx=nx+2*gx;
       int ndy=ny+2*gy;
       int ndz=nz+2*gz;
 
-      double * x = new double [ndx];
-      double * y = new double [ndy];
-      double * z = new double [ndz];
-
-      data->field_cells(x,y,z,gx,gy,gz);
-
-      void * array = field.values(index_field);
-
-      precision_type precision = field.precision(index_field);
+      // Extents of the ghost zones on this face
 
       int ix0=0 ,iy0=0,iz0=0;
 
@@ -78,95 +73,137 @@ void BoundaryValue::enforce
 	if (axis == axis_z) iz0 = ndz - gz;
       }
 
-      int i0=ix0 + ndx*(iy0 + ndy*iz0);
+      if (nx*ny*nz == 0) continue;
+
+      FaceValues face_values_temp;
 
-      bool * mask = 0;
+      FaceValues & face_values = block_cache ? 
+	(*block_cache)[(axis + 3*face) + 6*index] : face_values_temp;
 
-      if (mask_) mask = new bool [nx*ny*nz];
+      const bool evaluate = (face_values.values.size() == 0);
+
+      void * array = field.values(index_field);
+
+      precision_type precision = field.precision(index_field);
 
       switch (precision) {
       case precision_single:
-	{
-	  float * temp = 0;
-	  if (mask_) {
-	    temp = (float *)array;
-	    array = new float [ndx*ndy*ndz];
-	  }
-	  
-	  value_->evaluate((float *)array+i0, t, 
-			   ndx,nx,x+ix0, 
-			   ndy,ny,y+iy0,
-			   ndz,nz,z+iz0);
-	  if (mask_) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) ((float *)temp)[i]=((float *)array)[i];
-	    delete [] ((float*)array);
-	    array = temp;
-	  }
-	}
+	if (evaluate)
+	  evaluate_(&face_values,(float *)array,data,t,gx,gy,gz,
+		    ndx,ndy,ndz,nx,ny,nz,ix0,iy0,iz0);
+	copy_((float *)array,face_values,ndx,ndy,ndz,nx,ny,nz,ix0,iy0,iz0);
        	break;
       case precision_double:
-	{
-	  double * temp = 0;
-	  if (mask_) {
-	    temp = (double *)array;
-	    array = new double [ndx*ndy*ndz];
-	  }
-	  value_->evaluate((double *)array+i0, t, 
-			   ndx,nx,x+ix0, 
-			   ndy,ny,y+iy0,
-			   ndz,nz,z+iz0);
-	  if (mask_) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) ((double *)temp)[i]=((double *)array)[i];
-	    delete [] ((double *)array);
-	    array = temp;
-	  }
-	}
+	if (evaluate)
+	  evaluate_(&face_values,(double *)array,data,t,gx,gy,gz,
+		    ndx,ndy,ndz,nx,ny,nz,ix0,iy0,iz0);
+	copy_((double *)array,face_values,ndx,ndy,ndz,nx,ny,nz,ix0,iy0,iz0);
        	break;
       case precision_extended80:
       case precision_extended96:
       case precision_quadruple:
-	{
-	  long double * temp = 0;
-	  if (mask_) {
-	    temp = (long double *)array;
-	    array = new long double [ndx*ndy*ndz];
-	  }
-	  value_->evaluate((long double *)array+i0, t, 
-			   ndx,nx,x+ix0, 
-			   ndy,ny,y+iy0,
-			   ndz,nz,z+iz0);
-	  if (mask_) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) 
-	      ((long double *)temp)[i]=((long double *)array)[i];
-	    delete [] ((long double *)array);
-	    array = temp;
-	  }
-	}
+	if (evaluate)
+	  evaluate_(&face_values,(long double *)array,data,t,gx,gy,gz,
+		    ndx,ndy,ndz,nx,ny,nz,ix0,iy0,iz0);
+	copy_((long double *)array,face_values,
+	      ndx,ndy,ndz,nx,ny,nz,ix0,iy0,iz0);
        	break;
       }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void BoundaryValue::invalidate (Block * block) const throw()
+{
+  cache_.erase(block->name());
+}
+
+//----------------------------------------------------------------------
+
+bool BoundaryValue::is_cached_() const throw()
+{
+  // Values that do not assign every point keep the current field
+  // values elsewhere, so are never cached
+
+  return (! value_->depends_on_time() && value_->assigns_all() &&
+	  ! (mask_ && mask_->depends_on_time()));
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void BoundaryValue::evaluate_
+(FaceValues * face_values,
+ const T * field, Data * data, double t,
+ int gx, int gy, int gz,
+ int ndx, int ndy, int ndz,
+ int nx,  int ny,  int nz,
+ int ix0, int iy0, int iz0) const throw()
+{
+  std::vector<double> x(ndx), y(ndy), z(ndz);
 
-      delete [] x;
-      delete [] y;
-      delete [] z;
-      delete [] mask;
+  data->field_cells(&x[0],&y[0],&z[0],gx,gy,gz);
+
+  const int n = nx*ny*nz;
+
+  std::vector<double> & values = face_values->values;
+
+  values.resize(n);
+
+  // Initialize with current values where the Value assigns none
+
+  if (! value_->assigns_all()) {
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+	for (int ix=0; ix<nx; ix++) {
+	  int iv = ix + nx*(iy + ny*iz);
+	  int ib = (ix+ix0) + ndx*((iy+iy0) + ndy*(iz+iz0));
+	  values[iv] = (double) field[ib];
+	}
+      }
     }
   }
+
+  value_->evaluate(&values[0], t,
+		   nx,nx,&x[ix0], 
+		   ny,ny,&y[iy0],
+		   nz,nz,&z[iz0]);
+
+  std::vector<bool> & mask = face_values->mask;
+
+  mask.clear();
+
+  if (mask_) {
+    bool * mask_temp = new bool [n];
+    mask_->evaluate(mask_temp, t,
+		    nx,nx,&x[ix0],
+		    ny,ny,&y[iy0],
+		    nz,nz,&z[iz0]);
+    mask.assign(mask_temp,mask_temp+n);
+    delete [] mask_temp;
+  }
 }
 
 //----------------------------------------------------------------------
 
 template <class T>
-void BoundaryValue::copy_(T * field, double * value,
+void BoundaryValue::copy_(T * field, const FaceValues & face_values,
 			  int ndx, int ndy, int ndz,
 			  int nx,  int ny,  int nz,
 			  int ix0, int iy0, int iz0) const throw()
 {
-  for (int ix=ix0; ix<ix0+nx; ix++) {
-    for (int iy=iy0; iy<iy0+ny; iy++) {
-      for (int iz=iz0; iz<iz0+nz; iz++) {
-	int iv = (ix-ix0) + nx*((iy-iy0) + ny*(iz-iz0));
-	int ib = ix + ndx*(iy + ndy*(iz));
-	field[ib] = (T) value[iv];
+  const std::vector<double> & values = face_values.values;
+  const std::vector<bool>   & mask   = face_values.mask;
+  const bool use_mask = (mask.size() > 0);
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+	int iv = ix + nx*(iy + ny*iz);
+	int ib = (ix+ix0) + ndx*((iy+iy0) + ndy*(iz+iz0));
+	if (! use_mask || mask[iv]) field[ib] = (T) values[iv];
       }
     }
   }
@@ -14,18 +14,23 @@ class BoundaryValue : public Boundary
   /// @class    BoundaryValue
   /// @ingroup  Problem
   /// @brief    [\ref Problem] Encapsulate a BoundaryValue conditions generator
+  ///
+  /// If neither the Value nor the boundary Mask depends on time, the
+  /// boundary values for each Block face are evaluated once and
+  /// reused until invalidate() is called for the Block
 
 public: // interface
 
   /// Create a new BoundaryValue
   BoundaryValue() throw() 
-  : Boundary (), value_(0) 
+  : Boundary (), value_(0), cache_()
   {  }
 
   /// Create a new BoundaryValue
   BoundaryValue(axis_enum axis, face_enum face, Value * value, 
 		std::vector<std::string> field_list) throw() 
-    : Boundary(axis,face,0), value_(value), field_list_(field_list)
+    : Boundary(axis,face,0), value_(value), field_list_(field_list),
+      cache_()
   { }
 
   /// Destructor
@@ -45,6 +50,7 @@ public: // interface
 
     p | *value_;
     p | field_list_;
+    // SKIP cache_: recomputed when needed
   };
 
 public: // virtual functions
@@ -55,10 +61,34 @@ public: // virtual functions
 			face_enum face = face_all,
 			axis_enum axis = axis_all) const throw();
 
+  /// Discard cached boundary values for the Block
+  virtual void invalidate (Block * block) const throw();
+
+protected: // types
+
+  /// Boundary values on the ghost zones of one face for one field
+  struct FaceValues {
+    std::vector<double> values;
+    std::vector<bool>   mask;
+  };
+
 protected: // functions
 
+  /// Return whether boundary values can be cached between calls
+  bool is_cached_() const throw();
+
+  /// Evaluate the boundary values and mask on the ghost zones of a face
+  template <class T>
+  void evaluate_(FaceValues * face_values, 
+		 const T * field, Data * data, double t,
+		 int gx, int gy, int gz,
+		 int ndx, int ndy, int ndz,
+		 int nx,  int ny,  int nz,
+		 int ix0, int iy0, int iz0) const throw ();
+
+  /// Copy boundary values into the field where the mask is true
   template <class T>
-  void copy_(T * field, double * value,
+  void copy_(T * field, const FaceValues & face_values,
 	     int ndx, int ndy, int ndz,
 	     int nx,  int ny,  int nz,
 	     int ix0, int iy0, int iz0) const throw ();
@@ -68,6 +98,10 @@ protected: // attributes
   Value * value_;
   std::vector<std::string> field_list_;
 
+  /// Cached boundary values indexed by Block name, then by face,
+  /// axis and field: [(axis + 3*face) + 6*index_field]
+  mutable std::map<std::string, std::vector<FaceValues> > cache_;
+
 };
 
 #endif /* PROBLEM_BOUNDARY_VALUE_HPP */
@@ -62,6 +62,9 @@ public: // interface
 			 int ndy, int ny, double * y,
 			 int ndz, int nz, double * z) const = 0;
 
+  /// Return whether the mask depends on time
+  virtual bool depends_on_time() const = 0;
+
   
 private: // functions
 
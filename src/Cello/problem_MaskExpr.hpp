@@ -63,6 +63,10 @@ public: // interface
 			 int ndx, int nx, double * x,
 			 int ndy, int ny, double * y,
 			 int ndz, int nz, double * z) const;
+
+  /// Return whether the mask depends on time
+  virtual bool depends_on_time() const
+  { return param_->depends_on('t'); }
   
 private: // functions
 
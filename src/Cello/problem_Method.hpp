@@ -54,6 +54,12 @@ public: // virtual functions
   virtual double timestep (Block * block) const throw() 
   { return std::numeric_limits<double>::max(); }
 
+  /// Return whether Blocks in different levels may apply the Method
+  /// in different cycles (Adapt:subcycle); false for Methods that
+  /// synchronize all Blocks within compute()
+  virtual bool allow_subcycle () const throw()
+  { return true; }
+
   /// Resume computation after a reduction
   virtual void compute_resume ( Block * block,
 				CkReductionMsg * msg) throw()
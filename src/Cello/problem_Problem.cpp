@@ -337,6 +337,12 @@ void Problem::initialize_method
 
     if (method) {
 
+      if (config->adapt_subcycle && ! method->allow_subcycle()) {
+	ERROR1("Problem::initialize_method",
+	       "Method %s does not support Adapt:subcycle",
+	       name.c_str());
+      }
+
       method_list_.push_back(method); 
 
     } else {
@@ -606,6 +612,10 @@ Output * Problem::create_output_
 
     output = new OutputCheckpoint (index,factory,config,CkNumPes());
 
+  } else if (name == "analysis") {
+
+    output = new OutputAnalysis (index,factory,config,CkNumPes());
+
   }
 
   return output;
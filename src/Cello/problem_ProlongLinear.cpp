@@ -48,6 +48,15 @@ int ProlongLinear::apply
 
     break;
 
+  case precision_extended80:
+  case precision_extended96:
+  case precision_quadruple:
+
+    return apply_(       (long double *) values_f, nd3_f, im3_f, n3_f,
+                   (const long double *) values_c, nd3_c, im3_c, n3_c);
+
+    break;
+
   default:
 
     ERROR1 ("ProlongLinear::apply()",
@@ -65,13 +74,6 @@ int ProlongLinear::apply_
 (       T * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
   const T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3])
 {
-  int dx_c = 1;
-  int dy_c = nd3_c[0];
-  int dz_c = nd3_c[0]*nd3_c[1];
-
-  const double c1[4] = { 5.0*0.25, 3.0*0.25, 1.0*0.25, -1.0*0.25};
-  const double c2[4] = {-1.0*0.25, 1.0*0.25, 3.0*0.25,  5.0*0.25};
-
   int rank = (nd3_f[2] > 1) ? 3 : ( (nd3_f[1] > 1) ? 2 : 1 );
 
   for (int i=0; i<rank; i++) {
@@ -87,114 +89,127 @@ int ProlongLinear::apply_
   }
 
   if (n3_f[1]==1) {
+    return apply_rank_<T,1> (values_f, nd3_f, im3_f, n3_f,
+                             values_c, nd3_c, im3_c, n3_c);
+  } else if (n3_f[2] == 1) {
+    return apply_rank_<T,2> (values_f, nd3_f, im3_f, n3_f,
+                             values_c, nd3_c, im3_c, n3_c);
+  } else {
+    return apply_rank_<T,3> (values_f, nd3_f, im3_f, n3_f,
+                             values_c, nd3_c, im3_c, n3_c);
+  }
+}
 
-    for (int ix0=0; ix0<n3_f[0]; ix0+=4) {
-      int ic_x = ix0/2;
-      for (int ix=ix0; ix<ix0+4; ix++) {
-        int icx = ix-ix0;
-        int if_x = ix;
-
-        int i_c = im3_c[0]+ic_x;
-        int i_f = im3_f[0]+if_x;
-
-        values_f[i_f] = ( c1[icx]*values_c[i_c] + 
-                          c2[icx]*values_c[i_c+dx_c]);
+//----------------------------------------------------------------------
 
-        if (positive_ && (values_f[i_f] < 0)) {
-          // revert to linear
-          int icc = i_c + (icx/2)*dx_c;
-          values_f[i_f] = values_c[icc];          
-        }
-      }
-    }
+/// Each group of four fine cells along an axis is interpolated from
+/// the two coarse cells 2*(i/4) and 2*(i/4)+1 with weights c1[i%4]
+/// and c2[i%4].  Each fine row is computed with unit stride along x.
+/// The terms of each fine value are summed in the order of the
+/// point-wise formula, and the products of weights are multiples of
+/// 1/64 and so exact, so the result does not depend on the loop order.
 
-    return (sizeof(T) * n3_c[0]);
+template <class T, int RANK>
+int ProlongLinear::apply_rank_
+(       T * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+  const T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3])
+{
+  const int dy_c = nd3_c[0];
+  const int dz_c = nd3_c[0]*nd3_c[1];
 
+  const double c1[4] = { 5.0*0.25, 3.0*0.25, 1.0*0.25, -1.0*0.25};
+  const double c2[4] = {-1.0*0.25, 1.0*0.25, 3.0*0.25,  5.0*0.25};
 
-  } else if (n3_f[2] == 1) {
+  const int nx_f = n3_f[0];
+  const int ny_f = (RANK >= 2) ? n3_f[1] : 1;
+  const int nz_f = (RANK >= 3) ? n3_f[2] : 1;
+
+  for (int iz=0; iz<nz_f; iz++) {
+
+    const int icz = iz % 4;
+    const int iz_c = (RANK >= 3) ? 2*(iz/4) : 0;
+    const double wz1 = (RANK >= 3) ? c1[icz] : 1.0;
+    const double wz2 = (RANK >= 3) ? c2[icz] : 0.0;
+
+    for (int iy=0; iy<ny_f; iy++) {
+
+      const int icy = iy % 4;
+      const int iy_c = (RANK >= 2) ? 2*(iy/4) : 0;
+      const double wy1 = (RANK >= 2) ? c1[icy] : 1.0;
+      const double wy2 = (RANK >= 2) ? c2[icy] : 0.0;
+
+      // Weights of the 2, 4 or 8 coarse cells for each of the four
+      // fine cells in a group along x
+
+      double w[8][4];
+      for (int icx=0; icx<4; icx++) {
+        w[0][icx] = c1[icx]*wy1*wz1;
+        w[1][icx] = c2[icx]*wy1*wz1;
+        w[2][icx] = c1[icx]*wy2*wz1;
+        w[3][icx] = c2[icx]*wy2*wz1;
+        w[4][icx] = c1[icx]*wy1*wz2;
+        w[5][icx] = c2[icx]*wy1*wz2;
+        w[6][icx] = c1[icx]*wy2*wz2;
+        w[7][icx] = c2[icx]*wy2*wz2;
+      }
 
-    for (int ix0=0; ix0<n3_f[0]; ix0+=4) {
-      int ic_x = ix0/2;
-      for (int iy0=0; iy0<n3_f[1]; iy0+=4) {
-        int ic_y = iy0/2;
-        for (int ix=ix0; ix<ix0+4; ix++) {
-          int icx = ix-ix0;
-          int if_x = ix;
-          for (int iy=iy0; iy<iy0+4; iy++) {
-            int icy = iy-iy0;
-            int if_y = iy;
-
-            int i_c = (im3_c[0]+ic_x) + nd3_c[0]*
-              (       (im3_c[1]+ic_y));
-            int i_f = (im3_f[0]+if_x) + nd3_f[0]*
-              (       (im3_f[1]+if_y));
-
-            values_f[i_f] = 
-              ( c1[icx]*c1[icy]*values_c[i_c] +
-                c2[icx]*c1[icy]*values_c[i_c+dx_c] +
-                c1[icx]*c2[icy]*values_c[i_c     +dy_c] +
-                c2[icx]*c2[icy]*values_c[i_c+dx_c+dy_c]);
-            if (positive_ && (values_f[i_f] < 0)) {
-              // revert to linear
-              int icc = i_c + (icx/2)*dx_c + (icy/2)*dy_c;
-              values_f[i_f] = values_c[icc];          
-            }
+      const T * v_c = values_c + (im3_c[0]) + nd3_c[0]*
+        (       (im3_c[1]+iy_c) + nd3_c[1]*
+                (im3_c[2]+iz_c));
+
+      T * v_f = values_f + (im3_f[0]) + nd3_f[0]*
+        (       (im3_f[1]+iy) + nd3_f[1]*
+                (im3_f[2]+iz));
+
+      for (int ix0=0; ix0<nx_f; ix0+=4) {
+
+        const T * v = v_c + ix0/2;
+
+        for (int icx=0; icx<4; icx++) {
+          if (RANK == 1) {
+            v_f[ix0+icx] = 
+              ( w[0][icx]*v[0] + 
+                w[1][icx]*v[1]);
+          } else if (RANK == 2) {
+            v_f[ix0+icx] = 
+              ( w[0][icx]*v[0] +
+                w[1][icx]*v[1] +
+                w[2][icx]*v[  dy_c] +
+                w[3][icx]*v[1+dy_c]);
+          } else {
+            v_f[ix0+icx] = 
+              ( w[0][icx]*v[0] +
+                w[1][icx]*v[1] +
+                w[2][icx]*v[  dy_c] +
+                w[3][icx]*v[1+dy_c] +
+                w[4][icx]*v[       dz_c] +
+                w[5][icx]*v[1     +dz_c] +
+                w[6][icx]*v[  dy_c+dz_c] +
+                w[7][icx]*v[1+dy_c+dz_c]);
           }
         }
       }
-    }
-    return (sizeof(T) * n3_c[0]*n3_c[1]);
-
-  } else {
 
-    for (int ix0=0; ix0<n3_f[0]; ix0+=4) {
-      int ic_x = ix0/2;
-      for (int iy0=0; iy0<n3_f[1]; iy0+=4) {
-        int ic_y = iy0/2;
-        for (int iz0=0; iz0<n3_f[2]; iz0+=4) {
-          int ic_z = iz0/2;
-
-          for (int ix=ix0; ix<ix0+4; ix++) {
-            int icx = ix-ix0;
-            int if_x = ix;
-            for (int iy=iy0; iy<iy0+4; iy++) {
-              int icy = iy-iy0;
-              int if_y = iy;
-              for (int iz=iz0; iz<iz0+4; iz++) {
-                int icz = iz-iz0;
-                int if_z = iz;
-
-                int i_c = (im3_c[0]+ic_x) + nd3_c[0]*
-                  (       (im3_c[1]+ic_y) + nd3_c[1]*
-                          (im3_c[2]+ic_z));
-                int i_f = (im3_f[0]+if_x) + nd3_f[0]*
-                  (       (im3_f[1]+if_y) + nd3_f[1]*
-                          (im3_f[2]+if_z));
-
-                values_f[i_f] = 
-                  ( c1[icx]*c1[icy]*c1[icz]*values_c[i_c] +
-                    c2[icx]*c1[icy]*c1[icz]*values_c[i_c+dx_c] +
-                    c1[icx]*c2[icy]*c1[icz]*values_c[i_c     +dy_c] +
-                    c2[icx]*c2[icy]*c1[icz]*values_c[i_c+dx_c+dy_c] +
-                    c1[icx]*c1[icy]*c2[icz]*values_c[i_c          +dz_c] +
-                    c2[icx]*c1[icy]*c2[icz]*values_c[i_c+dx_c     +dz_c] +
-                    c1[icx]*c2[icy]*c2[icz]*values_c[i_c     +dy_c+dz_c] +
-                    c2[icx]*c2[icy]*c2[icz]*values_c[i_c+dx_c+dy_c+dz_c]);
-                if (positive_ && (values_f[i_f] < 0)) {
-		  WARNING("ProlongLinear::apply_()", "Reverting to linear");
-                  // revert to linear
-                  int icc = i_c + (icx/2)*dx_c + (icy/2)*dy_c + (icz/2)*dz_c;
-                  values_f[i_f] = values_c[icc];          
-                }
-              }
-            }
+      if (positive_) {
+        for (int ix=0; ix<nx_f; ix++) {
+          if (v_f[ix] < 0) {
+            if (RANK == 3) 
+              WARNING("ProlongLinear::apply_()", "Reverting to linear");
+            // revert to linear
+            const int icx = ix % 4;
+            int icc = 2*(ix/4) + (icx/2);
+            if (RANK >= 2) icc += (icy/2)*dy_c;
+            if (RANK >= 3) icc += (icz/2)*dz_c;
+            v_f[ix] = v_c[icc];
           }
         }
       }
     }
   }
-  return (sizeof(T) * n3_c[0]*n3_c[1]*n3_c[2]);
 
+  return (RANK == 1) ? (sizeof(T) * n3_c[0]) :
+    ((RANK == 2) ? (sizeof(T) * n3_c[0]*n3_c[1]) :
+     (sizeof(T) * n3_c[0]*n3_c[1]*n3_c[2]));
 }
 
 //======================================================================
@@ -45,6 +45,12 @@ private: // functions
   ( T *       values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
     const T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3]);
 
+  /// Prolong with loops specialized for the given rank
+  template <class T, int RANK>  
+  int apply_rank_
+  ( T *       values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+    const T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3]);
+
 private: // attributes
 
   // NOTE: change pup() function whenever attributes change
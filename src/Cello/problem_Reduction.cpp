@@ -0,0 +1,170 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_Reduction.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implementation of the Reduction class
+///
+/// A packed Reduction is the 2*n long double values and compensations
+/// followed by the n int operations.  Since each message carries its
+/// own operations, the single reducer r_reduction() serves every
+/// Method.
+
+#include "problem.hpp"
+
+#include "charm_mesh.hpp"
+
+CkReduction::reducerType r_reduction_type;
+
+extern CkReductionMsg * r_reduction(int n, CkReductionMsg ** msgs);
+
+//----------------------------------------------------------------------
+
+void register_reduction(void)
+{
+  r_reduction_type = CkReduction::addReducer(r_reduction);
+}
+
+//----------------------------------------------------------------------
+
+CkReductionMsg * r_reduction(int n, CkReductionMsg ** msgs)
+{
+  Reduction accum (msgs[0]);
+
+  for (int k=1; k<n; k++) {
+    accum.accumulate (Reduction(msgs[k]));
+  }
+
+  std::vector<char> buffer (accum.buffer_size());
+  accum.pack (&buffer[0]);
+
+  return CkReductionMsg::buildNew(buffer.size(),&buffer[0]);
+}
+
+//======================================================================
+
+Reduction::Reduction(int n, const char * buffer) throw()
+  : values_(), ops_()
+{
+  const int m = n / (2*sizeof(long double) + sizeof(int));
+
+  values_.resize(2*m);
+  ops_.resize(m);
+
+  if (m > 0) {
+    memcpy (&values_[0], buffer, 2*m*sizeof(long double));
+    memcpy (&ops_[0], buffer + 2*m*sizeof(long double), m*sizeof(int));
+  }
+}
+
+//----------------------------------------------------------------------
+
+Reduction::Reduction(CkReductionMsg * msg) throw()
+  : values_(), ops_()
+{
+  *this = Reduction (msg->getSize(), (const char *) msg->getData());
+}
+
+//----------------------------------------------------------------------
+
+int Reduction::add (int op, long double value) throw()
+{
+  ASSERT1 ("Reduction::add()",
+	   "Unknown reduction operation %d",
+	   op, (op == reduce_sum || op == reduce_sum_kahan ||
+		op == reduce_min || op == reduce_max));
+
+  const int index = ops_.size();
+
+  ops_.push_back(op);
+  values_.push_back(value);
+  values_.push_back(0.0);
+
+  return index;
+}
+
+//----------------------------------------------------------------------
+
+void Reduction::accumulate (int index, long double value) throw()
+{
+  long double & accum = values_[2*index];
+
+  switch (ops_[index]) {
+  case reduce_sum:       accum += value;             break;
+  case reduce_sum_kahan: sum_kahan_ (index,value);   break;
+  case reduce_min:       accum = MIN(accum,value);   break;
+  case reduce_max:       accum = MAX(accum,value);   break;
+  default:
+    ERROR1 ("Reduction::accumulate()",
+	    "Unknown reduction operation %d", ops_[index]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Reduction::accumulate (const Reduction & reduction) throw()
+{
+  ASSERT2 ("Reduction::accumulate()",
+	   "Reductions have different sizes %d and %d",
+	   size(), reduction.size(),
+	   size() == reduction.size());
+
+  for (int i=0; i<size(); i++) {
+
+    ASSERT3 ("Reduction::accumulate()",
+	     "Value %d has different operations %d and %d",
+	     i, ops_[i], reduction.ops_[i],
+	     ops_[i] == reduction.ops_[i]);
+
+    accumulate (i, reduction.values_[2*i]);
+
+    // compensation is 0 unless reduce_sum_kahan
+
+    values_[2*i+1] += reduction.values_[2*i+1];
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Reduction::pack (char * buffer) const throw()
+{
+  const int m = size();
+
+  if (m > 0) {
+    memcpy (buffer, &values_[0], 2*m*sizeof(long double));
+    memcpy (buffer + 2*m*sizeof(long double), &ops_[0], m*sizeof(int));
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Reduction::contribute (Block * block) const throw()
+{
+  std::vector<char> buffer (buffer_size());
+  pack (&buffer[0]);
+
+  CkCallback callback (CkIndex_Block::r_method_reduction(NULL),
+		       block->proxy_array());
+
+  block->contribute (buffer.size(), &buffer[0], r_reduction_type, callback);
+}
+
+//----------------------------------------------------------------------
+
+void Reduction::sum_kahan_ (int index, long double value) throw()
+{
+  // Neumaier's variant, which is also exact when |value| > |sum|
+
+  long double & sum          = values_[2*index];
+  long double & compensation = values_[2*index+1];
+
+  const long double t = sum + value;
+
+  if (fabsl(sum) >= fabsl(value)) {
+    compensation += (sum - t) + value;
+  } else {
+    compensation += (value - t) + sum;
+  }
+
+  sum = t;
+}
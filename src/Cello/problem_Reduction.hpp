@@ -0,0 +1,87 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_Reduction.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Problem] Declaration of the Reduction class
+
+#ifndef PROBLEM_REDUCTION_HPP
+#define PROBLEM_REDUCTION_HPP
+
+class Block;
+
+class Reduction {
+
+  /// @class    Reduction
+  /// @ingroup  Problem
+  /// @brief    [\ref Problem] List of values reduced over all Blocks
+  ///           with a single Charm++ reduction
+  ///
+  /// A Method adds its values with add(), each with its own
+  /// operation, and calls contribute().  The combined values are
+  /// returned to the Method's compute_resume(), which reads them by
+  /// index after constructing a Reduction from the message.
+
+public: // interface
+
+  /// Constructor
+  Reduction() throw()
+    : values_(), ops_()
+  { }
+
+  /// Create a Reduction from a packed buffer
+  Reduction(int n, const char * buffer) throw();
+
+  /// Create a Reduction from a reduction message
+  Reduction(CkReductionMsg * msg) throw();
+
+  /// Add a value with the given operation, returning its index
+  int add (int op, long double value) throw();
+
+  /// Combine a value into the value with the given index
+  void accumulate (int index, long double value) throw();
+
+  /// Combine the values of another Reduction with the same operations
+  void accumulate (const Reduction & reduction) throw();
+
+  /// Return the number of values
+  int size() const throw()
+  { return ops_.size(); }
+
+  /// Return the operation of the value with the given index
+  int op (int index) const throw()
+  { return ops_[index]; }
+
+  /// Return the value with the given index
+  long double value (int index) const throw()
+  { return values_[2*index] + values_[2*index+1]; }
+
+  /// Return the number of bytes in the packed buffer
+  int buffer_size() const throw()
+  { return size()*(2*sizeof(long double) + sizeof(int)); }
+
+  /// Pack the values and operations into the buffer
+  void pack (char * buffer) const throw();
+
+  /// Contribute the values to a reduction over all Blocks, which
+  /// resumes the Block's current Method with Method::compute_resume()
+  void contribute (Block * block) const throw();
+
+private: // functions
+
+  /// Add value to the sum with compensation at index
+  void sum_kahan_ (int index, long double value) throw();
+
+private: // attributes
+
+  /// Value and compensation for compensated sums (otherwise 0) of
+  /// each value
+  std::vector<long double> values_;
+
+  /// Operation of each value
+  std::vector<int> ops_;
+
+};
+
+#endif /* PROBLEM_REDUCTION_HPP */
+
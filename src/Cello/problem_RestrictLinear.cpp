@@ -38,6 +38,15 @@ int RestrictLinear::apply
 
     break;
 
+  case precision_extended80:
+  case precision_extended96:
+  case precision_quadruple:
+
+    return apply_( (long double *) values_c,       nd3_c, im3_c, n3_c,
+		   (const long double *) values_f, nd3_f, im3_f, n3_f);
+
+    break;
+
   default:
 
     ERROR1 ("RestrictLinear::apply()",
@@ -58,76 +67,81 @@ int RestrictLinear::apply_
 
   const int rank = (nd3_f[1] == 1) ? 1 : ((nd3_f[2] == 1) ? 2 : 3);
 
-  const int dx = 1;
-  const int dy = nd3_f[0];
-  const int dz = nd3_f[0]*nd3_f[1];
-
   if (rank == 1) {
-
-    for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-      int ix_f = ix_c*2;
-
-      int i_c = (im3_c[0]+ix_c);
-      int i_f = (im3_f[0]+ix_f);
-
-      values_c[i_c] = 0.5 *
-	( values_f[i_f     ] + 
-	  values_f[i_f + dx] );
-    }
-
+    apply_rank_<T,1> (values_c, nd3_c, im3_c, n3_c,
+		      values_f, nd3_f, im3_f, n3_f);
   } else if (rank == 2) {
+    apply_rank_<T,2> (values_c, nd3_c, im3_c, n3_c,
+		      values_f, nd3_f, im3_f, n3_f);
+  } else if (rank == 3) {
+    apply_rank_<T,3> (values_c, nd3_c, im3_c, n3_c,
+		      values_f, nd3_f, im3_f, n3_f);
+  }
+  return (sizeof(T) * n3_c[0]*n3_c[1]*n3_c[2]);
+}
 
-    for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-      int ix_f = ix_c*2;
-      for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	int iy_f = iy_c*2;
+//----------------------------------------------------------------------
 
-	int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	  (       (im3_c[1]+iy_c));
-	int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	  (       (im3_f[1]+iy_f));
+/// Loops run with x innermost so that coarse values are written, and
+/// each fine row read, with unit stride
 
-	values_c[i_c] = 0.25 *
-	  ( values_f[i_f          ] + 
-	    values_f[i_f + dx     ] +
-	    values_f[i_f +      dy] + 
-	    values_f[i_f + dx + dy] );
+template<class T, int RANK>
+int RestrictLinear::apply_rank_
+( T *       values_c, int nd3_c[3], int im3_c[3],  int n3_c[3],
+  const T * values_f, int nd3_f[3], int im3_f[3],  int n3_f[3])
+{
+  const int dy = nd3_f[0];
+  const int dz = nd3_f[0]*nd3_f[1];
 
-	// if (values_c[i_c] < 0.0) {
-	//   printf ("RestrictLinear %d %d\n",ix_c,iy_c);
-	//   printf ("RestrictLinear %f   =   %f %f %f %f\n",
-	// 	  values_c[i_c],values_f[i_f],values_f[i_f+dx],values_f[i_f+dy],values_f[i_f+dx+dy]);
-	// }
+  const int nx_c = n3_c[0];
+  const int ny_c = (RANK >= 2) ? n3_c[1] : 1;
+  const int nz_c = (RANK >= 3) ? n3_c[2] : 1;
+
+  for (int iz_c=0; iz_c<nz_c; iz_c++) {
+    const int iz_f = iz_c*2;
+    for (int iy_c=0; iy_c<ny_c; iy_c++) {
+      const int iy_f = iy_c*2;
+
+      T * v_c = values_c + (im3_c[0]) + nd3_c[0]*
+	(       (im3_c[1]+iy_c) + nd3_c[1]*
+		(im3_c[2]+iz_c));
+      const T * v_f = values_f + (im3_f[0]) + nd3_f[0]*
+	(       (im3_f[1]+iy_f) + nd3_f[1]*
+		(im3_f[2]+iz_f));
+
+      if (RANK == 1) {
+
+	for (int ix_c=0; ix_c<nx_c; ix_c++) {
+	  const int i_f = ix_c*2;
+	  v_c[ix_c] = 0.5 *
+	    ( v_f[i_f    ] + 
+	      v_f[i_f + 1] );
+	}
 
-      }
-    }
+      } else if (RANK == 2) {
 
-    
-  } else if (rank == 3) {
+	for (int ix_c=0; ix_c<nx_c; ix_c++) {
+	  const int i_f = ix_c*2;
+	  v_c[ix_c] = 0.25 *
+	    ( v_f[i_f         ] + 
+	      v_f[i_f + 1     ] +
+	      v_f[i_f +     dy] + 
+	      v_f[i_f + 1 + dy] );
+	}
 
-    for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-      int ix_f = ix_c*2;
-      for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	int iy_f = iy_c*2;
-	for (int iz_c=0; iz_c<n3_c[2]; iz_c++) {
-	  int iz_f = iz_c*2;
-
-	  int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	    (       (im3_c[1]+iy_c) + nd3_c[1]*
-		    (im3_c[2]+iz_c));
-	  int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	    (       (im3_f[1]+iy_f) + nd3_f[1]*
-		    (im3_f[2]+iz_f));
-
-	  values_c[i_c] = 0.125 * 
-	    ( values_f[i_f               ] + 
-	      values_f[i_f + dx          ] +
-	      values_f[i_f +      dy     ] + 
-	      values_f[i_f + dx + dy     ] +
-	      values_f[i_f           + dz] + 
-	      values_f[i_f + dx      + dz] +
-	      values_f[i_f +      dy + dz] + 
-	      values_f[i_f + dx + dy + dz] );
+      } else {
+
+	for (int ix_c=0; ix_c<nx_c; ix_c++) {
+	  const int i_f = ix_c*2;
+	  v_c[ix_c] = 0.125 * 
+	    ( v_f[i_f              ] + 
+	      v_f[i_f + 1          ] +
+	      v_f[i_f +     dy     ] + 
+	      v_f[i_f + 1 + dy     ] +
+	      v_f[i_f          + dz] + 
+	      v_f[i_f + 1      + dz] +
+	      v_f[i_f +     dy + dz] + 
+	      v_f[i_f + 1 + dy + dz] );
 	}
       }
     }
@@ -71,6 +71,9 @@ public: // interface
     evaluate(value,t,ndx,nx,x,ndy,ny,y,ndz,nz,z,0,0);
   }
 
+  /// Return whether the expression depends on time
+  bool depends_on_time() const
+  { return param_ && param_->depends_on('t'); }
   
 private: // functions
 
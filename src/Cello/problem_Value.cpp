@@ -62,6 +62,18 @@ double Value::evaluate (double t, double x, double y, double z) throw ()
 
 //----------------------------------------------------------------------
 
+bool Value::depends_on_time() const throw()
+{
+  for (size_t index = 0; index < scalar_expr_list_.size(); index++) {
+    if (scalar_expr_list_[index]->depends_on_time()) return true;
+    Mask * mask = mask_list_[index];
+    if (mask && mask->depends_on_time()) return true;
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------
+
 template <class T>
 void Value::evaluate
 (T * values, double t,
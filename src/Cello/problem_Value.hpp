@@ -52,6 +52,14 @@ public: // interface
 
   double evaluate (double t, double x, double y, double z) throw ();
 
+  /// Return whether any expression or mask depends on time
+  bool depends_on_time() const throw();
+
+  /// Return whether the last expression is unmasked, so that
+  /// evaluate() assigns every value
+  bool assigns_all() const throw()
+  { return mask_list_.size() > 0 && mask_list_.back() == NULL; }
+
 private: // functions
 
   void copy_(const Value & value) throw();
@@ -12,6 +12,49 @@
 #include "simulation.hpp"
 #include "charm_simulation.hpp"
 
+CkReduction::reducerType r_reduce_performance_type;
+
+extern CkReductionMsg * r_reduce_performance(int n, CkReductionMsg ** msgs);
+
+//----------------------------------------------------------------------
+
+void register_reduce_performance(void)
+{
+  r_reduce_performance_type = CkReduction::addReducer(r_reduce_performance);
+}
+
+//----------------------------------------------------------------------
+
+CkReductionMsg * r_reduce_performance(int n, CkReductionMsg ** msgs)
+{
+  // Values are stored as (min, max, sum, sum of squares) tuples
+
+  const int size = msgs[0]->getSize();
+  const int m = size / sizeof(double);
+
+  double * accum = new double [m];
+  double * values = (double *) msgs[0]->getData();
+  for (int i=0; i<m; i++) accum[i] = values[i];
+
+  for (int k=1; k<n; k++) {
+    values = (double *) msgs[k]->getData();
+    for (int i=0; i<m; i+=4) {
+      accum[i+0] =  MIN(accum[i+0],values[i+0]);
+      accum[i+1] =  MAX(accum[i+1],values[i+1]);
+      accum[i+2] += values[i+2];
+      accum[i+3] += values[i+3];
+    }
+  }
+
+  CkReductionMsg * msg = CkReductionMsg::buildNew(size,accum);
+
+  delete [] accum;
+
+  return msg;
+}
+
+//======================================================================
+
 Simulation::Simulation
 (
  const char *   parameter_file,
@@ -32,11 +75,13 @@ Simulation::Simulation
   timer_(),
   performance_(NULL),
   performance_name_(""),
+  trace_(NULL),
   performance_stride_(1),
   // projections_tracing_(1),
   monitor_(0),
   hierarchy_(0),
-  field_descr_(0)
+  field_descr_(0),
+  refine_count_(0)
 {
   debug_open();
 
@@ -94,6 +139,14 @@ void Simulation::pup (PUP::er &p)
   p | performance_name_;
   p | performance_stride_;
 
+  // Trace events are not checkpointed, but the Trace is so that a
+  // restart appends to the existing trace file
+
+  bool have_trace = (trace_ != NULL);
+  p | have_trace;
+  if (up) trace_ = have_trace ? new Trace : NULL;
+  if (have_trace) p | *trace_;
+
   // p | projections_tracing_;
   // if (up) projections_schedule_on_ = new Schedule;
   // p | *projections_schedule_on_;
@@ -118,6 +171,8 @@ void Simulation::pup (PUP::er &p)
 
   if (up) sync_output_begin_.set_stop(0);
   if (up) sync_output_write_.set_stop(0);
+
+  p | refine_count_;
 }
 
 //----------------------------------------------------------------------
@@ -171,7 +226,14 @@ void Simulation::initialize_simulation_() throw()
 void Simulation::initialize_memory_() throw()
 {
   Memory * memory = Memory::instance();
-  if (memory) memory->set_active(config_->memory_active);
+  if (memory) {
+    memory->set_active(config_->memory_active);
+    if (! config_->memory_fill) {
+      memory->set_fill_new(0);
+      memory->set_fill_delete(0);
+    }
+    memory->set_sample_interval(config_->memory_sample_interval);
+  }
   
 }
 //----------------------------------------------------------------------
@@ -205,6 +267,49 @@ void Simulation::initialize_performance_() throw()
 
   performance_->start_region(perf_simulation);
 
+  initialize_trace_();
+
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::initialize_trace_() throw()
+{
+  const std::string format = config_->performance_trace_name;
+
+  if (format == "") return;
+
+  ASSERT1 ("Simulation::initialize_trace_",
+	   "Performance:trace:name \"%s\" must contain %%d for the process rank",
+	   format.c_str(), format.find("%") != std::string::npos);
+
+  char file_name [255];
+  snprintf (file_name,255,format.c_str(),CkMyPe());
+
+  trace_ = new Trace (file_name,config_->performance_trace_size,CkMyPe());
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::initialize_performance_methods_() throw()
+{
+  Method * method;
+  for (int i=0; (method = problem_->method(i)); i++) {
+    performance_->new_region(performance_region_method(i),
+			     "method-" + method->name());
+    performance_->new_region(performance_region_refresh(i),
+			     "refresh-" + method->name());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::reduce_performance_stats_
+(const double * stats, int np, double * mean, double * stddev) const throw()
+{
+  (*mean) = stats[2] / np;
+  double variance = stats[3] / np - (*mean)*(*mean);
+  (*stddev) = sqrt(MAX(variance,0.0));
 }
 
 //----------------------------------------------------------------------
@@ -364,7 +469,20 @@ void Simulation::initialize_forest_() throw()
   bool allocate_data = ! ( config_->initial_type == "file" || 
 			   config_->initial_type == "checkpoint" );
 
-  if (allocate_blocks) {
+  if (config_->mesh_distributed_insert) {
+
+    // Create the empty Block array only: each process inserts its
+    // own Blocks in p_initialize_forest_local()
+
+    if (allocate_blocks) {
+      hierarchy_->create_forest
+	(field_descr_,
+	 allocate_data,
+	 false,
+	 false);
+    }
+
+  } else if (allocate_blocks) {
 
     // Create the root-level blocks for level = 0
     hierarchy_->create_forest
@@ -393,6 +511,7 @@ void Simulation::deallocate_() throw()
   delete hierarchy_;     hierarchy_ = 0;
   delete field_descr_;   field_descr_ = 0;
   delete performance_;   performance_ = 0;
+  delete trace_;         trace_ = 0;
 }
 
 //----------------------------------------------------------------------
@@ -458,26 +577,44 @@ void Simulation::monitor_performance()
   int n = nr * nc + 1;
 
   long long * counters_long_long = new long long [nc];
-  long *      counters_long = new long [n];
+  double *    counters_stats = new double [4*n];
+
+  // Each value contributes (min, max, sum, sum of squares) so that
+  // imbalance across processes can be reported
 
   for (int ir = 0; ir < nr; ir++) {
     performance_->region_counters(ir,counters_long_long);
     for (int ic = 0; ic < nc; ic++) {
       int index_counter = ir+nr*ic;
-      counters_long[index_counter] = 
-	(long) counters_long_long[ic];
+      double value = (double) counters_long_long[ic];
+      counters_stats[4*index_counter+0] = value;
+      counters_stats[4*index_counter+1] = value;
+      counters_stats[4*index_counter+2] = value;
+      counters_stats[4*index_counter+3] = value*value;
     }
   }
 
-  counters_long[n-1] = hierarchy()->num_blocks(); // number of Blocks
+  double num_blocks = hierarchy()->num_blocks(); // number of Blocks
+  counters_stats[4*(n-1)+0] = num_blocks;
+  counters_stats[4*(n-1)+1] = num_blocks;
+  counters_stats[4*(n-1)+2] = num_blocks;
+  counters_stats[4*(n-1)+3] = num_blocks*num_blocks;
+
+  // Write trace events every trace interval cycles
+
+  const int interval = config_->performance_trace_interval;
+  if (trace_ && interval > 0 && (cycle_ % interval) == 0) {
+    trace_flush();
+  }
 
   // --------------------------------------------------
   CkCallback callback (CkIndex_Simulation::r_monitor_performance(NULL), 
 		       thisProxy);
-  contribute (n*sizeof(long), counters_long,CkReduction::sum_long,callback);
+  contribute (4*n*sizeof(double), counters_stats,
+	      r_reduce_performance_type,callback);
   // --------------------------------------------------
 
-  delete [] counters_long;
+  delete [] counters_stats;
   delete [] counters_long_long;
 
 }
@@ -491,27 +628,46 @@ void Simulation::r_monitor_performance(CkReductionMsg * msg)
 
   int n = nr * nc + 1;
 
-  long *      counters_long = (long * )msg->getData();
+  double * counters_stats = (double * )msg->getData();
+
+  const int np = CkNumPes();
 
   int index_region_cycle = performance_->region_index("cycle");
 
   for (int ir = 0; ir < nr; ir++) {
     for (int ic = 0; ic < nc; ic++) {
       int index_counter = ir+nr*ic;
-      bool do_print = 
-	(performance_->counter_type(ic) != counter_type_abs) ||
-	(ir == index_region_cycle);
+      bool is_abs = (performance_->counter_type(ic) == counter_type_abs);
+      bool do_print = (! is_abs) || (ir == index_region_cycle);
       if (do_print) {
+	const double * stats = counters_stats + 4*index_counter;
 	monitor()->print("Performance","%s %s %ld",
 			performance_->region_name(ir).c_str(),
 			performance_->counter_name(ic).c_str(),
-			counters_long[index_counter]);
+			(long) stats[2]);
+	if (! is_abs && stats[1] > 0.0) {
+	  double mean,stddev;
+	  reduce_performance_stats_(stats,np,&mean,&stddev);
+	  monitor()->print("Performance",
+			   "%s %s min %ld max %ld mean %ld stddev %ld",
+			   performance_->region_name(ir).c_str(),
+			   performance_->counter_name(ic).c_str(),
+			   (long) stats[0],(long) stats[1],
+			   (long) mean,(long) stddev);
+	}
       }
     }
   }
 
+  const double * stats = counters_stats + 4*(n-1);
+  double mean,stddev;
+  reduce_performance_stats_(stats,np,&mean,&stddev);
+
   monitor()->print("Performance","simulation num-blocks %d",
-		  counters_long[n-1]);
+		   (int) stats[2]);
+  monitor()->print("Performance",
+		   "simulation num-blocks min %d max %d mean %g stddev %g",
+		   (int) stats[0],(int) stats[1],mean,stddev);
 
   Memory::instance()->reset_high();
 
@@ -90,6 +90,23 @@ public: // interface
   Performance * performance() throw()
   { return performance_; }
 
+  /// Return the Trace object, or NULL if tracing is not enabled
+  Trace * trace() throw()
+  { return trace_; }
+
+  /// Write any recorded Trace events to disk
+  void trace_flush() throw()
+  { if (trace_) trace_->flush(performance_); }
+
+  /// Return the Performance region for computing the given Method
+  int performance_region_method (int index_method) const throw()
+  { return perf_last + 2*index_method; }
+
+  /// Return the Performance region for Refresh operations issued
+  /// by the given Method
+  int performance_region_refresh (int index_method) const throw()
+  { return perf_last + 2*index_method + 1; }
+
   /// Return the monitor object
   Monitor * monitor() const throw()
   { return monitor_; }
@@ -181,9 +198,23 @@ public: // virtual functions
   /// Remove a Block from this local branch
   void delete_block() ;
 
+  /// Count a Block refined on this process during initial refinement
+  void increment_refine_count()
+  { ++refine_count_; }
+
+  /// Sum the Blocks refined in the last initial adapt step
+  void p_adapt_initial_count();
+
+  /// Continue initial refinement only if any Block was refined
+  void r_adapt_initial_count(CkReductionMsg * msg);
+
   /// Wait for all Hierarchy to be initialized before creating any Blocks
   void r_initialize_forest(CkReductionMsg * msg);
 
+  /// Insert this process's Blocks into the Block array created on
+  /// the root process (Mesh:distributed_insert)
+  void p_initialize_forest_local(CProxy_Block block_array);
+
   /// Wait for all local patches to be created before calling run
   void r_initialize_hierarchy(CkReductionMsg * msg);
 
@@ -239,6 +270,18 @@ protected: // functions
   /// Initialize performance objects
   void initialize_performance_ () throw();
 
+  /// Initialize the Trace event recorder if enabled
+  void initialize_trace_ () throw();
+
+  /// Add Performance regions for each Method in the Problem
+  void initialize_performance_methods_ () throw();
+
+  /// Return the mean and standard deviation over np processes of
+  /// reduced (min, max, sum, sum of squares) performance values
+  void reduce_performance_stats_
+  (const double * stats, int np, double * mean, double * stddev)
+    const throw();
+
   /// Initialize output Monitor object
   void initialize_monitor_ () throw();
 
@@ -315,6 +358,9 @@ protected: // attributes
   /// Performance file name format (requires %d for process rank)
   std::string performance_name_;
 
+  /// Timeline event recorder for this process, or NULL if disabled
+  Trace * trace_;
+
   /// Processor stride for writing strict processor subset of performance data
   int performance_stride_;
 
@@ -339,6 +385,10 @@ protected: // attributes
   Sync sync_output_begin_;
   Sync sync_output_write_;
 
+  /// Number of Blocks refined on this process since the last
+  /// p_adapt_initial_count()
+  int refine_count_;
+
 };
 
 #endif /* SIMULATION_SIMULATION_HPP */
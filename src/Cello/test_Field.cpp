@@ -284,6 +284,27 @@ PARALLEL_MAIN_BEGIN
     unit_assert (field->values (1000) == NULL);
     unit_assert (field->values ("not a field") == NULL);
 
+    unit_func("view");  // with ghosts
+
+    FieldHandle h2 (field_descr,"f2");
+    FieldHandle h5 (field_descr,"f5");
+    FieldHandle h0 (field_descr,"not a field");
+
+    unit_assert (h2.is_field() && h2.id() == i2);
+    unit_assert (h5.is_field() && h5.id() == i5);
+    unit_assert (! h0.is_field());
+
+    FieldView<double> view2 = field->view<double>(h2);
+    unit_assert (view2.values() == v2);
+    unit_assert (field->view<long double>(h5).values() == v5);
+    unit_assert (! field->view<double>(h0).is_valid());
+
+    int m3[3],d3[3];
+    field->dimensions (i2,&m3[0],&m3[1],&m3[2]);
+    view2.dimensions (&d3[0],&d3[1],&d3[2]);
+    unit_assert (m3[0]==d3[0] && m3[1]==d3[1] && m3[2]==d3[2]);
+    unit_assert (&view2(1,2,3) == v2 + 1 + m3[0]*(2 + m3[1]*3));
+
     unit_func("unknowns");  // with ghosts
 
     u1 = (float *)       field->unknowns(i1);
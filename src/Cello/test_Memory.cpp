@@ -226,6 +226,19 @@ PARALLEL_MAIN_BEGIN
   unit_func ("num_delete()");
   unit_assert(memory->num_delete() == del_count);
 
+  // set_sample_interval()
+  unit_func ("set_sample_interval()");
+
+  unit_assert(memory->num_sites() == 0);
+
+  memory->set_sample_interval(1);
+  memory->set_active(true);
+  char * temp_2 = new char [100];
+  delete [] temp_2;
+  memory->set_active(false);
+
+  unit_assert(memory->num_sites() == 1);
+
   memory->print();
 #else /* CONFIG_USE_MEMORY */
   unit_func("CONFIG_USE_MEMORY");
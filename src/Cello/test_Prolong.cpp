@@ -0,0 +1,241 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Prolong.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Test and benchmark program for the ProlongLinear and
+///           RestrictLinear classes
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "problem.hpp"
+
+//----------------------------------------------------------------------
+
+/// Reference prolongation using point-wise evaluation of the linear
+/// scheme: fine cell i uses coarse cells 2*(i/4) and 2*(i/4)+1
+
+template <class T>
+void prolong_reference
+(T * values_f, int nd3_f[3], int im3_f[3], int n3_f[3],
+ const T * values_c, int nd3_c[3], int im3_c[3], int rank)
+{
+  const double c1[4] = { 5.0*0.25, 3.0*0.25, 1.0*0.25, -1.0*0.25};
+  const double c2[4] = {-1.0*0.25, 1.0*0.25, 3.0*0.25,  5.0*0.25};
+
+  for (int iz=0; iz<n3_f[2]; iz++) {
+    for (int iy=0; iy<n3_f[1]; iy++) {
+      for (int ix=0; ix<n3_f[0]; ix++) {
+	double value = 0.0;
+	for (int kz=0; kz<((rank>=3) ? 2 : 1); kz++) {
+	  double wz = (rank>=3) ? (kz ? c2[iz%4] : c1[iz%4]) : 1.0;
+	  int jz = (rank>=3) ? 2*(iz/4)+kz : 0;
+	  for (int ky=0; ky<((rank>=2) ? 2 : 1); ky++) {
+	    double wy = (rank>=2) ? (ky ? c2[iy%4] : c1[iy%4]) : 1.0;
+	    int jy = (rank>=2) ? 2*(iy/4)+ky : 0;
+	    for (int kx=0; kx<2; kx++) {
+	      double wx = kx ? c2[ix%4] : c1[ix%4];
+	      int jx = 2*(ix/4)+kx;
+	      int i_c = (im3_c[0]+jx) + nd3_c[0]*
+		((im3_c[1]+jy) + nd3_c[1]*(im3_c[2]+jz));
+	      value += wx*wy*wz*values_c[i_c];
+	    }
+	  }
+	}
+	int i_f = (im3_f[0]+ix) + nd3_f[0]*
+	  ((im3_f[1]+iy) + nd3_f[1]*(im3_f[2]+iz));
+	values_f[i_f] = value;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Reference restriction by averaging the 2, 4 or 8 fine children
+
+template <class T>
+void restrict_reference
+(T * values_c, int nd3_c[3], int im3_c[3], int n3_c[3],
+ const T * values_f, int nd3_f[3], int im3_f[3], int rank)
+{
+  const int mx = 2;
+  const int my = (rank >= 2) ? 2 : 1;
+  const int mz = (rank >= 3) ? 2 : 1;
+
+  for (int iz=0; iz<n3_c[2]; iz++) {
+    for (int iy=0; iy<n3_c[1]; iy++) {
+      for (int ix=0; ix<n3_c[0]; ix++) {
+	double sum = 0.0;
+	for (int kz=0; kz<mz; kz++) {
+	  for (int ky=0; ky<my; ky++) {
+	    for (int kx=0; kx<mx; kx++) {
+	      int i_f = (im3_f[0]+2*ix+kx) + nd3_f[0]*
+		((im3_f[1]+2*iy+ky) + nd3_f[1]*(im3_f[2]+2*iz+kz));
+	      sum += values_f[i_f];
+	    }
+	  }
+	}
+	int i_c = (im3_c[0]+ix) + nd3_c[0]*
+	  ((im3_c[1]+iy) + nd3_c[1]*(im3_c[2]+iz));
+	values_c[i_c] = sum / (mx*my*mz);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+/// Return the maximum absolute difference over the n3 region
+
+template <class T>
+double max_error
+(const T * a, const T * b, int nd3[3], int im3[3], int n3[3])
+{
+  double error = 0.0;
+  for (int iz=0; iz<n3[2]; iz++) {
+    for (int iy=0; iy<n3[1]; iy++) {
+      for (int ix=0; ix<n3[0]; ix++) {
+	int i = (im3[0]+ix) + nd3[0]*((im3[1]+iy) + nd3[1]*(im3[2]+iz));
+	double d = (double)a[i] - (double)b[i];
+	error = std::max(error, (d < 0) ? -d : d);
+      }
+    }
+  }
+  return error;
+}
+
+//----------------------------------------------------------------------
+
+/// Test the Prolong and Restrict kernels against the reference
+/// versions, then time them on a face-sized and a block-sized region
+
+template <class T>
+void test_prolong_restrict (precision_type precision, int rank,
+			    double tolerance, const char * precision_name)
+{
+  const int n = 32;     // fine block size
+  const int g = 4;      // ghost depth
+
+  int n3_f[3]  = {n, (rank>=2) ? n : 1, (rank>=3) ? n : 1};
+  int nd3_f[3] = {n+2*g, (rank>=2) ? n+2*g : 1, (rank>=3) ? n+2*g : 1};
+  int im3_f[3] = {g, (rank>=2) ? g : 0, (rank>=3) ? g : 0};
+
+  int n3_c[3]  = {n/2, (rank>=2) ? n/2 : 1, (rank>=3) ? n/2 : 1};
+  int nd3_c[3] = {nd3_f[0],nd3_f[1],nd3_f[2]};
+  int im3_c[3] = {g/2, (rank>=2) ? g/2 : 0, (rank>=3) ? g/2 : 0};
+
+  const int m_f = nd3_f[0]*nd3_f[1]*nd3_f[2];
+  const int m_c = nd3_c[0]*nd3_c[1]*nd3_c[2];
+
+  T * values_c = new T [m_c];
+  T * values_f = new T [m_f];
+  T * values_r = new T [m_f];
+  T * values_cr = new T [m_c];
+
+  for (int i=0; i<m_c; i++) values_c[i] = 1.0 + ((7*i) % 13) / 13.0;
+  for (int i=0; i<m_f; i++) values_f[i] = values_r[i] = 0.0;
+  for (int i=0; i<m_c; i++) values_cr[i] = values_c[i];
+
+  ProlongLinear prolong;
+  RestrictLinear restrict;
+
+  char buffer[80];
+
+  sprintf (buffer,"apply() [prolong rank %d %s]",rank,precision_name);
+  unit_func (buffer);
+
+  prolong.apply (precision,
+		 values_f, nd3_f, im3_f, n3_f,
+		 values_c, nd3_c, im3_c, n3_c);
+
+  prolong_reference (values_r, nd3_f, im3_f, n3_f,
+		     values_c, nd3_c, im3_c, rank);
+
+  // Both sum the same terms in the same order in double precision,
+  // so they agree bit for bit unless T is wider than double
+
+  if (sizeof(T) <= sizeof(double)) {
+    unit_assert (max_error(values_f,values_r,nd3_f,im3_f,n3_f) == 0.0);
+  } else {
+    unit_assert (max_error(values_f,values_r,nd3_f,im3_f,n3_f) < tolerance);
+  }
+
+  sprintf (buffer,"apply() [restrict rank %d %s]",rank,precision_name);
+  unit_func (buffer);
+
+  restrict.apply (precision,
+		  values_c,  nd3_c, im3_c, n3_c,
+		  values_f,  nd3_f, im3_f, n3_f);
+  restrict_reference (values_cr, nd3_c, im3_c, n3_c,
+		      values_f,  nd3_f, im3_f, rank);
+
+  unit_assert (max_error(values_c,values_cr,nd3_c,im3_c,n3_c) < tolerance);
+
+  // Benchmark
+
+  const int num_repeat = (rank == 3) ? 100 : 10000;
+
+  Timer timer;
+
+  timer.start();
+  for (int i=0; i<num_repeat; i++) {
+    prolong.apply (precision,
+		   values_f, nd3_f, im3_f, n3_f,
+		   values_c, nd3_c, im3_c, n3_c);
+  }
+  timer.stop();
+
+  const double time_prolong = timer.value() / num_repeat;
+
+  timer.clear();
+  timer.start();
+  for (int i=0; i<num_repeat; i++) {
+    restrict.apply (precision,
+		    values_c,  nd3_c, im3_c, n3_c,
+		    values_f,  nd3_f, im3_f, n3_f);
+  }
+  timer.stop();
+
+  const double time_restrict = timer.value() / num_repeat;
+
+  const double num_cells = n3_f[0]*n3_f[1]*n3_f[2];
+
+  PARALLEL_PRINTF ("ProlongLinear  rank %d %-6s %8.3f us  %8.3f ns/fine cell\n",
+		   rank,precision_name,
+		   1e6*time_prolong, 1e9*time_prolong/num_cells);
+  PARALLEL_PRINTF ("RestrictLinear rank %d %-6s %8.3f us  %8.3f ns/fine cell\n",
+		   rank,precision_name,
+		   1e6*time_restrict, 1e9*time_restrict/num_cells);
+
+  delete [] values_c;
+  delete [] values_f;
+  delete [] values_r;
+  delete [] values_cr;
+}
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ProlongLinear");
+
+  for (int rank = 1; rank <= 3; rank++) {
+    test_prolong_restrict<float>      (precision_single, rank, 1e-4, "single");
+    test_prolong_restrict<double>     (precision_double, rank, 1e-12,"double");
+    test_prolong_restrict<long double>(precision_quadruple,rank,1e-12,"quad");
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+
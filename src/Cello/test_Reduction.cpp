@@ -0,0 +1,94 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_Reduction.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Test program for the Reduction class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "problem.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Reduction");
+
+  Reduction reduction_1;
+
+  //--------------------------------------------------
+
+  unit_func ("add()");
+
+  const int i_sum   = reduction_1.add (reduce_sum,       1.0);
+  const int i_kahan = reduction_1.add (reduce_sum_kahan, 1.0);
+  const int i_min   = reduction_1.add (reduce_min,       3.0);
+  const int i_max   = reduction_1.add (reduce_max,       3.0);
+
+  unit_assert (i_sum == 0 && i_kahan == 1 && i_min == 2 && i_max == 3);
+  unit_assert (reduction_1.size() == 4);
+  unit_assert (reduction_1.op(i_kahan) == reduce_sum_kahan);
+  unit_assert (reduction_1.value(i_min) == 3.0);
+
+  //--------------------------------------------------
+
+  unit_func ("accumulate()");
+
+  Reduction reduction_2;
+
+  reduction_2.add (reduce_sum,       2.0);
+  reduction_2.add (reduce_sum_kahan, 2.0);
+  reduction_2.add (reduce_min,       -4.0);
+  reduction_2.add (reduce_max,       -4.0);
+
+  reduction_1.accumulate (reduction_2);
+
+  unit_assert (reduction_1.value(i_sum)   == 3.0);
+  unit_assert (reduction_1.value(i_kahan) == 3.0);
+  unit_assert (reduction_1.value(i_min)   == -4.0);
+  unit_assert (reduction_1.value(i_max)   == 3.0);
+
+  // Small values lost by a plain sum are kept by the compensated sum
+
+  Reduction reduction_3;
+  reduction_3.add (reduce_sum,       1.0e40);
+  reduction_3.add (reduce_sum_kahan, 1.0e40);
+  for (int k=0; k<1000; k++) {
+    reduction_3.accumulate (0, 1.0);
+    reduction_3.accumulate (1, 1.0);
+  }
+  reduction_3.accumulate (0, -1.0e40);
+  reduction_3.accumulate (1, -1.0e40);
+
+  unit_assert (reduction_3.value(0) == 0.0);
+  unit_assert (reduction_3.value(1) == 1000.0);
+
+  //--------------------------------------------------
+
+  unit_func ("pack()");
+
+  std::vector<char> buffer (reduction_1.buffer_size());
+  reduction_1.pack (&buffer[0]);
+
+  Reduction reduction_4 (buffer.size(), &buffer[0]);
+
+  unit_assert (reduction_4.size() == reduction_1.size());
+  for (int i=0; i<reduction_4.size(); i++) {
+    unit_assert (reduction_4.op(i)    == reduction_1.op(i));
+    unit_assert (reduction_4.value(i) == reduction_1.value(i));
+  }
+
+  //--------------------------------------------------
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
+
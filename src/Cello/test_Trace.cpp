@@ -0,0 +1,89 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file      test_Trace.cpp
+/// @author    James Bordner (jobordner@ucsd.edu)
+/// @date      2026-10-19
+/// @brief     Program implementing unit tests for the Trace class
+
+#include "main.hpp" 
+#include "test.hpp"
+
+#include "performance.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("Trace");
+
+  Performance * performance = new Performance (NULL);
+
+  performance->new_region(0,"region_1");
+  performance->new_region(1,"region_2");
+
+  Trace * trace = new Trace ("test_Trace.json",4,0);
+
+  unit_func("Trace");
+  unit_assert (trace->num_events() == 0);
+
+  unit_func("new_thread");
+  int thread_1 = trace->new_thread("thread_1");
+  int thread_2 = trace->new_thread("thread_2");
+  unit_assert (thread_1 != thread_2);
+
+  unit_func("record");
+  trace->record (0,thread_1,100,10);
+  trace->record (1,thread_2,105,20);
+  unit_assert (trace->num_events() == 2);
+  unit_assert (trace->num_dropped() == 0);
+
+  // Overfill the ring buffer
+
+  for (int i=0; i<4; i++) {
+    trace->record (i%2,thread_1,200+i,1);
+  }
+  unit_assert (trace->num_events() == 4);
+  unit_assert (trace->num_dropped() == 2);
+
+  unit_func("flush");
+  trace->flush(performance);
+  unit_assert (trace->num_events() == 0);
+  unit_assert (trace->num_dropped() == 0);
+
+  FILE * fp = fopen ("test_Trace.json","r");
+  unit_assert (fp != NULL);
+  int num_lines = 0;
+  int c;
+  while ((c = fgetc(fp)) != EOF) if (c == '\n') ++num_lines;
+  fclose (fp);
+
+  // "[", process name, two thread names, four events
+  unit_assert (num_lines == 8);
+
+  unit_func("delete_thread");
+  trace->delete_thread(thread_1);
+  int thread_3 = trace->new_thread("thread_3");
+  unit_assert (thread_3 == thread_1);
+  unit_assert (trace->num_threads() == 2);
+
+  // Reused thread is renamed in the next flush
+
+  trace->flush(performance);
+  fp = fopen ("test_Trace.json","r");
+  unit_assert (fp != NULL);
+  num_lines = 0;
+  while ((c = fgetc(fp)) != EOF) if (c == '\n') ++num_lines;
+  fclose (fp);
+  unit_assert (num_lines == 9);
+
+  delete trace;
+  delete performance;
+
+  unit_finalize();
+
+  exit_();
+}
+PARALLEL_MAIN_END
@@ -32,6 +32,12 @@
 #define MASK3_STR1  "\"input/testValue.png\""
 #define EXPR3_VAL2  (1.0 - t - 10.0*x - 100.0*y - 1000.0*z)
 #define EXPR3_STR2 "(1.0 - t - 10.0*x - 100.0*y - 1000.0*z)"
+
+#define EXPR4_STR1 "(1.0 + 2.0*x*y - z)"
+#define MASK4_STR1 "(x < y)"
+#define EXPR5_STR1 "(x + y)"
+#define MASK5_STR1 "(t > 1.0)"
+#define EXPR5_STR2 "(x - y)"
 //----------------------------------------------------------------------
 
 void generate_input()
@@ -49,6 +55,9 @@ void generate_input()
   fp << "    value1 = [" EXPR1_STR "];  \n";
   fp << "    value2 = [" EXPR2_STR1 ",\n" MASK2_STR1 ",\n" EXPR2_STR2 ",\n" MASK2_STR2 ",\n" EXPR2_STR3 "];\n";
   fp << "    value3 = [" EXPR3_STR1 ",\n" MASK3_STR1 ",\n" EXPR3_STR2 "];\n";
+  fp << "    value4 = [" EXPR4_STR1 ",\n" MASK4_STR1 "];\n";
+  fp << "    value5 = [" EXPR5_STR1 ",\n" MASK5_STR1 ",\n" EXPR5_STR2 "];\n";
+  fp << "    value6 = [" EXPR5_STR2 "];\n";
   fp << "}\n";
 
   fp.close();
@@ -177,6 +186,30 @@ PARALLEL_MAIN_BEGIN
     }
   }
 
+  //--------------------------------------------------
+
+  unit_func ("depends_on_time()");
+
+  Value * value4 = new Value(&parameters, "Group:value4");
+  Value * value5 = new Value(&parameters, "Group:value5");
+  Value * value6 = new Value(&parameters, "Group:value6");
+
+  unit_assert (value1->depends_on_time());
+  unit_assert (value2->depends_on_time());
+  unit_assert (value3->depends_on_time());
+  unit_assert (! value4->depends_on_time());
+  unit_assert (value5->depends_on_time());
+  unit_assert (! value6->depends_on_time());
+
+  unit_func ("assigns_all()");
+
+  unit_assert (value1->assigns_all());
+  unit_assert (value2->assigns_all());
+  unit_assert (value3->assigns_all());
+  unit_assert (! value4->assigns_all());
+  unit_assert (value5->assigns_all());
+  unit_assert (value6->assigns_all());
+
   //----------------------------------------------------------------------
 
   unit_finalize();
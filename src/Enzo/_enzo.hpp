@@ -86,6 +86,21 @@ enum hydro_type
     hydro_ppml
   };
 
+//----------------------------------------------------------------------
+// Order of the fluxes stored for each face in EnzoBlock flux registers,
+// with colour fields following flux_colour
+
+enum flux_register_enum
+  {
+    flux_density,
+    flux_total_energy,
+    flux_velocity_x,
+    flux_velocity_y,
+    flux_velocity_z,
+    flux_internal_energy,
+    flux_colour
+  };
+
 //----------------------------------------------------------------------
 
 enum return_enum {
@@ -166,9 +181,11 @@ struct fluxes
 #include "enzo_EnzoMethodPpm.hpp"
 #include "enzo_EnzoMethodPpml.hpp"
 #include "enzo_EnzoMethodHeat.hpp"
+#include "enzo_EnzoMethodMuscl.hpp"
 #include "enzo_EnzoMethodGrackle.hpp"
 #include "enzo_EnzoMethodTurbulence.hpp"
 #include "enzo_EnzoMethodGravityCg.hpp"
+#include "enzo_EnzoMethodHeatImplicit.hpp"
 #include "enzo_EnzoMethodGravityMlat.hpp"
 #include "enzo_EnzoMethodGravityMg0.hpp"
 #include "enzo_EnzoMethodGravityBiCGStab.hpp"
@@ -176,8 +193,10 @@ struct fluxes
 #include "enzo_EnzoMatrixLaplace.hpp"
 #include "enzo_EnzoMatrixDiagonal.hpp"
 #include "enzo_EnzoMatrixIdentity.hpp"
+#include "enzo_EnzoMatrixDiffusion.hpp"
 
 #include "enzo_EnzoComputePressure.hpp"
+#include "enzo_EnzoComputePpm.hpp"
 #include "enzo_EnzoComputeTemperature.hpp"
 #include "enzo_EnzoComputeAcceleration.hpp"
 #include "enzo_EnzoComputeSmoothJacobi.hpp"
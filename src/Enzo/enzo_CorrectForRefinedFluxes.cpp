@@ -0,0 +1,269 @@
+// See LICENSE_ENZO file for license and copyright information
+
+/// @file      enzo_CorrectForRefinedFluxes.cpp
+/// @author    James Bordner (jobordner@ucsd.edu)
+/// @date      2026-10-19
+/// @brief     Flux registers for conservative flux correction between
+///            Blocks in adjacent refinement levels
+///
+/// SolveHydroEquations() saves the PPM fluxes across the faces of
+/// Blocks with a face neighbor in a different level.  A fine Block
+/// sends the fluxes across a face shared with a coarser neighbor,
+/// averaged to the coarse resolution, with the restricted field data
+/// of the next refresh; the coarse Block then replaces its own flux
+/// across the face with the fine fluxes in the adjacent cells, as in
+/// Enzo's grid::CorrectForRefinedFluxes().  All levels take the same
+/// timestep, so no time averaging is needed.
+
+#include "cello.hpp"
+
+#include "enzo.hpp"
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::load_flux_face
+(int * n, char ** array, const int if3[3]) throw()
+{
+  *n = 0;
+  *array = 0;
+
+  if (! flux_register_current_()) return;
+
+  const int rank = this->rank();
+
+  const int axis = (if3[0] != 0) ? 0 : ((if3[1] != 0) ? 1 : 2);
+  const int face = (if3[axis] > 0) ? 1 : 0;
+
+  // Send the fluxes only with the first refresh after the PPM step
+
+  const int bit = 1 << (2*axis + face);
+
+  if (flux_register_sent_ & bit) return;
+
+  flux_register_sent_ |= bit;
+
+  Field field = data()->field();
+
+  const int ncolour  = field.groups()->size("colour");
+  const int num_flux = flux_colour + ncolour;
+
+  // Face cells in this Block (ni,nj) and in the coarse neighbor (mi,mj)
+
+  const int idim = (axis == 0) ? 1 : 0;
+  const int jdim = (axis == 2) ? 1 : 2;
+
+  const int ni = GridEndIndex[idim] - GridStartIndex[idim] + 1;
+  const int nj = GridEndIndex[jdim] - GridStartIndex[jdim] + 1;
+  const int ri = (idim < rank) ? 2 : 1;
+  const int rj = (jdim < rank) ? 2 : 1;
+  const int mi = ni / ri;
+  const int mj = nj / rj;
+
+  // Fluxes are scaled by dt/dx, and dx is half that of the coarse
+  // neighbor, so the average over fine faces is also halved
+
+  const enzo_float scale = 0.5 / (ri*rj);
+
+  flux_register_send_.assign(num_flux*mi*mj, 0.0);
+
+  for (int index_flux = 0; index_flux < num_flux; index_flux++) {
+
+    const enzo_float * flux = &flux_register_
+      [flux_register_offset_(axis,face,index_flux,ncolour)];
+
+    enzo_float * flux_send = &flux_register_send_[index_flux*mi*mj];
+
+    for (int jf = 0; jf < nj; jf++) {
+      for (int i_f = 0; i_f < ni; i_f++) {
+	flux_send[i_f/ri + mi*(jf/rj)] += scale*flux[i_f + ni*jf];
+      }
+    }
+  }
+
+  *n     = flux_register_send_.size()*sizeof(enzo_float);
+  *array = (char *) &flux_register_send_[0];
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::store_flux_face
+(int n, char * array, const int if3[3], const int ic3[3]) throw()
+{
+  // Skip if this Block has no fluxes from the preceding PPM step to
+  // correct, e.g. if it was created by refinement since the step, or
+  // was a parent whose children were just coarsened into it and whose
+  // flux register is left from before it refined
+
+  if (! flux_register_current_()) return;
+
+  const int rank = this->rank();
+
+  const int axis = (if3[0] != 0) ? 0 : ((if3[1] != 0) ? 1 : 2);
+  const int face = (if3[axis] > 0) ? 1 : 0;
+
+  Field field = data()->field();
+
+  const int ncolour  = field.groups()->size("colour");
+  const int num_flux = flux_colour + ncolour;
+
+  // Face cells in this Block (ni,nj), and the part (mi,mj) starting
+  // at (oi,oj) covered by the fine child ic3
+
+  const int idim = (axis == 0) ? 1 : 0;
+  const int jdim = (axis == 2) ? 1 : 2;
+
+  const int ni = GridEndIndex[idim] - GridStartIndex[idim] + 1;
+  const int nj = GridEndIndex[jdim] - GridStartIndex[jdim] + 1;
+  const int mi = (idim < rank) ? ni / 2 : ni;
+  const int mj = (jdim < rank) ? nj / 2 : nj;
+  const int oi = (idim < rank) ? ic3[idim]*mi : 0;
+  const int oj = (jdim < rank) ? ic3[jdim]*mj : 0;
+
+  ASSERT3 ("EnzoBlock::store_flux_face()",
+	   "Received %d bytes of fluxes but expected %d for face axis %d",
+	   n, int(num_flux*mi*mj*sizeof(enzo_float)), axis,
+	   n == int(num_flux*mi*mj*sizeof(enzo_float)));
+
+  // Copy to align the fine fluxes, which follow the field data
+
+  flux_register_send_.resize(num_flux*mi*mj);
+  memcpy (&flux_register_send_[0], array, n);
+
+  const enzo_float * flux_fine = &flux_register_send_[0];
+
+  std::vector<int> offset (num_flux);
+  for (int index_flux = 0; index_flux < num_flux; index_flux++) {
+    offset[index_flux] = flux_register_offset_(axis,face,index_flux,ncolour);
+  }
+
+  // Fields updated by the fluxes
+
+  enzo_float * density      = (enzo_float *) field.values("density");
+  enzo_float * total_energy = (enzo_float *) field.values("total_energy");
+  enzo_float * velocity[3]  =
+    { (enzo_float *) field.values("velocity_x"),
+      (enzo_float *) field.values("velocity_y"),
+      (enzo_float *) field.values("velocity_z") };
+
+  std::vector<enzo_float *> colour;
+  for (int index_field = 0;
+       index_field < field.field_count();
+       index_field++) {
+    std::string name = field.field_name(index_field);
+    if (field.groups()->is_in(name,"colour")) {
+      colour.push_back((enzo_float *)field.values(index_field));
+    }
+  }
+
+  // The flux across a lower face was added to the adjacent cell, and
+  // across an upper face subtracted from it
+
+  const enzo_float sign = (face == 0) ? 1.0 : -1.0;
+
+  int i3[3];
+  i3[axis] = (face == 0) ? GridStartIndex[axis] : GridEndIndex[axis];
+
+  for (int jc = 0; jc < mj; jc++) {
+    for (int ic = 0; ic < mi; ic++) {
+
+      i3[idim] = GridStartIndex[idim] + oi + ic;
+      i3[jdim] = GridStartIndex[jdim] + oj + jc;
+
+      const int i = i3[0] + GridDimension[0]*(i3[1] + GridDimension[1]*i3[2]);
+      const int i_register = (oi + ic) + ni*(oj + jc);
+      const int i_fine     = ic + mi*jc;
+
+#define FLUX_DIFFERENCE(INDEX_FLUX)					\
+      (sign*(flux_fine[(INDEX_FLUX)*mi*mj + i_fine] -			\
+	     flux_register_[offset[INDEX_FLUX] + i_register]))
+
+      const enzo_float density_old = density[i];
+      const enzo_float density_new =
+	density_old + FLUX_DIFFERENCE(flux_density);
+
+      // Leave the cell uncorrected rather than make the density negative
+
+      if (density_new <= 0.0) continue;
+
+      // Velocity and total energy are specific, so correct their
+      // conserved densities (the internal energy is not corrected)
+
+      total_energy[i] = (density_old*total_energy[i] +
+			 FLUX_DIFFERENCE(flux_total_energy)) / density_new;
+
+      for (int dim = 0; dim < rank; dim++) {
+	velocity[dim][i] = (density_old*velocity[dim][i] +
+			    FLUX_DIFFERENCE(flux_velocity_x + dim)) / density_new;
+      }
+
+      density[i] = density_new;
+
+      for (int index_colour = 0; index_colour < ncolour; index_colour++) {
+	colour[index_colour][i] += FLUX_DIFFERENCE(flux_colour + index_colour);
+      }
+
+#undef FLUX_DIFFERENCE
+
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoBlock::flux_register_current_() const
+{
+  // The fluxes are sent with the first refresh after the PPM step,
+  // which is in the same cycle if a later Method refreshes, and
+  // otherwise in the next one
+
+  const int age = cycle() - flux_register_cycle_;
+
+  return (flux_register_.size() > 0) && (0 <= age && age <= 1);
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoBlock::flux_register_needed_() const
+{
+  const int level = this->level();
+  const int rank  = this->rank();
+
+  for (int axis = 0; axis < rank; axis++) {
+    for (int face = -1; face <= 1; face += 2) {
+      int if3[3] = {0,0,0};
+      if3[axis] = face;
+      if (face_level(if3) != level) return true;
+    }
+  }
+  return false;
+}
+
+//----------------------------------------------------------------------
+
+int EnzoBlock::flux_register_face_size_(int axis) const
+{
+  const int idim = (axis == 0) ? 1 : 0;
+  const int jdim = (axis == 2) ? 1 : 2;
+
+  return (GridEndIndex[idim] - GridStartIndex[idim] + 1) *
+    (GridEndIndex[jdim] - GridStartIndex[jdim] + 1);
+}
+
+//----------------------------------------------------------------------
+
+int EnzoBlock::flux_register_offset_
+(int axis, int face, int index_flux, int ncolour) const
+{
+  const int num_flux = flux_colour + ncolour;
+
+  int offset = 0;
+  for (int dim = 0; dim < axis; dim++) {
+    offset += 2*num_flux*flux_register_face_size_(dim);
+  }
+
+  if (axis < rank()) {
+    offset += (face*num_flux + index_flux)*flux_register_face_size_(axis);
+  }
+
+  return offset;
+}
@@ -38,6 +38,8 @@ int EnzoBlock::ProblemType;
 int EnzoBlock::PPMFlatteningParameter;
 int EnzoBlock::PPMDiffusionParameter;
 int EnzoBlock::PPMSteepeningParameter;
+int EnzoBlock::PPMSweepThreads;
+int EnzoBlock::PPMFluxCorrection;
 
 // Numerics
 
@@ -119,6 +121,8 @@ void EnzoBlock::initialize(EnzoConfig * enzo_config,
   PPMFlatteningParameter    = enzo_config->ppm_flattening;
   PPMDiffusionParameter     = enzo_config->ppm_diffusion;
   PPMSteepeningParameter    = enzo_config->ppm_steepening;
+  PPMSweepThreads           = enzo_config->ppm_sweep_threads;
+  PPMFluxCorrection         = enzo_config->ppm_flux_correct;
   pressure_floor            = enzo_config->ppm_pressure_floor;
   density_floor             = enzo_config->ppm_density_floor;
   temperature_floor         = enzo_config->ppm_temperature_floor;
@@ -191,6 +195,9 @@ EnzoBlock::EnzoBlock
      narray,  array, op_array,
      num_face_level, face_level,
      testing),
+    colour_offset_set_(false),
+    flux_register_sent_(0),
+    flux_register_cycle_(-1),
     dt(dt),
     SubgridFluxes(0)
 {
@@ -259,11 +266,15 @@ void EnzoBlock::pup(PUP::er &p)
     WARNING("EnzoBlock::pup()", "skipping OldBaryonField[] [not used]");
   }
 
-  PUParray(p,method_turbulence_data,MAX_TURBULENCE_ARRAY);
-
   p | mg_sync_;
   p | mg_iter_;
 
+  // Flux registers are held between the PPM step and the next refresh,
+  // which may span a checkpoint or load balancing
+  p | flux_register_;
+  p | flux_register_sent_;
+  p | flux_register_cycle_;
+
   TRACE ("END EnzoBlock::pup()");
 
 }
@@ -314,6 +325,10 @@ void EnzoBlock::write(FILE * fp) throw ()
 	   PPMDiffusionParameter);
   fprintf (fp,"EnzoBlock: PPMSteepeningParameter %d\n",
 	   PPMSteepeningParameter);
+  fprintf (fp,"EnzoBlock: PPMSweepThreads %d\n",
+	   PPMSweepThreads);
+  fprintf (fp,"EnzoBlock: PPMFluxCorrection %d\n",
+	   PPMFluxCorrection);
 
   // Numerics
 
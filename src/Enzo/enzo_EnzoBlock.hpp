@@ -71,6 +71,8 @@ public:
   static int PPMFlatteningParameter;
   static int PPMDiffusionParameter;
   static int PPMSteepeningParameter;
+  static int PPMSweepThreads;
+  static int PPMFluxCorrection;
 
   // Parallel
 
@@ -121,11 +123,18 @@ public: // interface
    bool testing=false) throw();
 
   /// Initialize an empty EnzoBlock
-  EnzoBlock()  { };
+  EnzoBlock()
+    : colour_offset_set_(false),
+      flux_register_sent_(0),
+      flux_register_cycle_(-1)
+  { };
 
   /// Initialize a migrated EnzoBlock
   EnzoBlock (CkMigrateMessage *m) 
-    : Block (m)
+    : Block (m),
+      colour_offset_set_(false),
+      flux_register_sent_(0),
+      flux_register_cycle_(-1)
   {
     TRACE("CkMigrateMessage");
     //    initialize();
@@ -198,10 +207,39 @@ public: // interface
   int SetMinimumSupport(enzo_float &MinimumSupportEnergyCoefficient,
 			int comoving_coordinates);
 
-  /// Solve the hydro equations using PPM
+  /// Solve the hydro equations using PPM, with fields resolved by
+  /// the calling Method
   int SolveHydroEquations ( enzo_float time, 
 			    enzo_float dt,
-			    int comoving_coordinates);
+			    int comoving_coordinates,
+			    const FieldHandle & density,
+			    const FieldHandle & total_energy,
+			    const FieldHandle & internal_energy,
+			    const FieldHandle velocity[3],
+			    const FieldHandle acceleration[3]);
+
+  /// Apply the PPM directional sweeps with slices distributed
+  /// over PPMSweepThreads threads; replaces the serial ppm_de() loop
+  void SolvePPMSweeps
+  (enzo_float *d, enzo_float *E, enzo_float *u, enzo_float *v, enzo_float *w,
+   enzo_float *ge, int gravity,
+   enzo_float *gr_ax, enzo_float *gr_ay, enzo_float *gr_az,
+   enzo_float dt, enzo_float dx[], int ncolour, enzo_float *colourpt,
+   int *coloff, int *colindex, enzo_float *standard,
+   int nsubgrids, int *leftface, int *rightface,
+   int *istart, int *iend, int *jstart, int *jend,
+   int *dindex, int *Eindex, int *uindex, int *vindex, int *windex,
+   int *geindex);
+
+  /// Return fluxes across face if3 from the last PPM step, averaged
+  /// to the resolution of the coarser neighbor across the face
+  virtual void load_flux_face (int * n, char ** array, const int if3[3])
+    throw();
+
+  /// Correct cells along face if3 by the difference between the
+  /// fluxes of finer neighbor ic3 and this Block's fluxes
+  virtual void store_flux_face (int n, char * array,
+				const int if3[3], const int ic3[3]) throw();
 
   /// Solve the hydro equations using Enzo 3.0 PPM
   int SolveHydroEquations3 ( enzo_float time, enzo_float dt);
@@ -220,15 +258,6 @@ public: // interface
 
 public: /// entry methods
 
-  /// Compute sum, min, and max of g values for EnzoMethodTurbulence
-  void method_turbulence_begin();
-
-  /// Perform the necessary reductions
-  CkReductionMsg * r_method_turbulence(int n, CkReductionMsg ** msgs);
-
-  /// Compute sum, min, and max of g values for EnzoMethodTurbulence
-  void p_method_turbulence_end(CkReductionMsg *msg);
-
   /// EnzoMethodGravityCg entry method: DOT ==> refresh P
   template <class T>
   void r_cg_loop_0a (CkReductionMsg * msg) ;  
@@ -332,6 +361,27 @@ public: /// entry methods
 protected: // functions
 
   void enzo_matvec_() ;
+
+  /// Return whether a face neighbor is in a different level, so that
+  /// the Block's fluxes are needed for flux correction
+  bool flux_register_needed_() const;
+
+  /// Return the number of cells in the face normal to the axis
+  int flux_register_face_size_(int axis) const;
+
+  /// Return whether flux_register_ holds the fluxes of the PPM step in
+  /// this or the previous cycle, and so may be sent or corrected
+  bool flux_register_current_() const;
+
+  /// Return the offset of the given flux for the face in flux_register_;
+  /// axis = rank returns the size of flux_register_
+  int flux_register_offset_(int axis, int face, int index_flux,
+			    int ncolour) const;
+
+  /// Return the PPM slice temporaries, with room for at least size
+  /// values, shared by all Blocks on the calling PE
+  static enzo_float * hydro_temp_ (int size) throw();
+
   void gravity_bicgstab_matvec_1_();
   void gravity_bicgstab_matvec_2_();
 
@@ -344,6 +394,28 @@ protected: // attributes
   // MG iteration count
   int mg_iter_;
 
+  // SolveHydroEquations() workspace, sized on first use and kept
+  // between cycles; not packed, so rebuilt after migration
+
+  /// Offsets of colour fields into the permanent field array
+  std::vector<int> colour_offset_;
+  /// Whether colour_offset_ has been computed
+  bool colour_offset_set_;
+  /// Subgrid flux index arrays passed to ppm_de()
+  std::vector<int> hydro_index_;
+  /// Zero velocity_y and velocity_z for rank < 3
+  std::vector<enzo_float> hydro_velocity_;
+
+  /// Fluxes across the Block's faces from the last PPM step, in the
+  /// order of flux_register_enum; empty if not needed
+  std::vector<enzo_float> flux_register_;
+  /// Bit 2*axis+face is set once that face's fluxes have been sent
+  int flux_register_sent_;
+  /// Cycle of the PPM step that filled flux_register_
+  int flux_register_cycle_;
+  /// Averaged fluxes returned by load_flux_face()
+  std::vector<enzo_float> flux_register_send_;
+
 public: // attributes (YIKES!)
 
   union {
@@ -367,9 +439,6 @@ public: // attributes (YIKES!)
   int GridEndIndex[MAX_DIMENSION]; 
   enzo_float CellWidth[MAX_DIMENSION];
 
-  /// Data for turbulence reductions
-  double method_turbulence_data [MAX_TURBULENCE_ARRAY];
-
 };
 
 #endif /* ENZO_ENZO_BLOCK_HPP */
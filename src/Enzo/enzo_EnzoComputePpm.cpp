@@ -0,0 +1,581 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoComputePpm.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implements the EnzoComputePpm class
+
+#include "cello.hpp"
+
+#include "enzo.hpp"
+
+/// Number of cells in a tile of pencils gathered into scratch arrays;
+/// sized so that all scratch arrays for a tile fit in L2 cache
+#define PPM_TILE_CELLS 2048
+
+/// Two-shock Riemann solver Newton iterations.  The count is fixed
+/// (no convergence test) so that all lanes stay in lock step
+#define PPM_RIEMANN_ITER 5
+
+/// CW84 flattening and diffusion constants
+#define PPM_FLATTEN_EPSILON  0.33
+#define PPM_FLATTEN_OMEGA1   0.75
+#define PPM_FLATTEN_OMEGA2  10.0
+#define PPM_DIFFUSION_K      0.1
+
+//----------------------------------------------------------------------
+
+EnzoComputePpm::EnzoComputePpm (const FieldDescr * field_descr,
+				double gamma,
+				int comoving_coordinates)
+  : Compute(),
+    gamma_(gamma),
+    comoving_coordinates_(comoving_coordinates),
+    density_(field_descr,"density"),
+    total_energy_(field_descr,"total_energy"),
+    colour_(),
+    scratch_buffer_(),
+    tile_base_()
+{
+  velocity_[0]     = FieldHandle(field_descr,"velocity_x");
+  velocity_[1]     = FieldHandle(field_descr,"velocity_y");
+  velocity_[2]     = FieldHandle(field_descr,"velocity_z");
+  acceleration_[0] = FieldHandle(field_descr,"acceleration_x");
+  acceleration_[1] = FieldHandle(field_descr,"acceleration_y");
+  acceleration_[2] = FieldHandle(field_descr,"acceleration_z");
+
+  for (int index_field = 0;
+       index_field < field_descr->field_count();
+       index_field++) {
+    std::string name = field_descr->field_name(index_field);
+    if (field_descr->groups()->is_in(name,"colour")) {
+      colour_.push_back(FieldHandle(field_descr,name));
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoComputePpm::pup (PUP::er &p)
+{
+
+  // NOTE: change this function whenever attributes change
+
+  TRACEPUP;
+
+  Compute::pup(p);
+
+  p | gamma_;
+  p | comoving_coordinates_;
+  p | density_;
+  p | total_energy_;
+  PUParray(p,velocity_,3);
+  PUParray(p,acceleration_,3);
+  p | colour_;
+
+}
+
+//----------------------------------------------------------------------
+
+void EnzoComputePpm::compute ( Block * block) throw()
+{
+  if (!block->is_leaf()) return;
+
+  Field field = block->data()->field();
+
+  const int p = field.precision (density_.id());
+
+  if      (p == precision_single)    compute_<float>(block);
+  else if (p == precision_double)    compute_<double>(block);
+  else if (p == precision_quadruple) compute_<long double>(block);
+  else
+    ERROR1("EnzoComputePpm()", "precision %d not recognized", p);
+}
+
+//----------------------------------------------------------------------
+
+template <typename T>
+void EnzoComputePpm::compute_(Block * block)
+{
+  const int rank = block->rank();
+
+  if      (rank == 1) compute_rank_<T,1>(block);
+  else if (rank == 2) compute_rank_<T,2>(block);
+  else if (rank == 3) compute_rank_<T,3>(block);
+}
+
+//----------------------------------------------------------------------
+
+template <typename T, int RANK>
+void EnzoComputePpm::compute_rank_(Block * block)
+{
+  EnzoBlock * enzo_block = static_cast<EnzoBlock*> (block);
+
+  Data * data = block->data();
+  Field field = data->field();
+
+  FieldView<T> density = field.view<T>(density_);
+
+  T * d  = density.values();
+  T * te = field.view<T>(total_energy_).values();
+  T * v3[3] =
+    { field.view<T>(velocity_[0]).values(),
+      (RANK >= 2) ? field.view<T>(velocity_[1]).values() : NULL,
+      (RANK >= 3) ? field.view<T>(velocity_[2]).values() : NULL };
+
+  // gravity is included if acceleration fields are defined; views of
+  // undefined fields are NULL
+
+  T * a3[3] = { NULL, NULL, NULL };
+  for (int axis = 0; axis < RANK; axis++) {
+    a3[axis] = field.view<T>(acceleration_[axis]).values();
+  }
+
+  // colour fields are advected as mass fractions
+
+  std::vector<T *> colour (colour_.size());
+  for (size_t ic = 0; ic < colour_.size(); ic++) {
+    colour[ic] = field.view<T>(colour_[ic]).values();
+  }
+
+  int m3[3];
+  density.dimensions (&m3[0],&m3[1],&m3[2]);
+  int g3[3];
+  density.ghost_depth (&g3[0],&g3[1],&g3[2]);
+
+  for (int axis = 0; axis < RANK; axis++) {
+    ASSERT2 ("EnzoComputePpm::compute_rank_()",
+	     "ghost depth %d along axis %d must be at least 3",
+	     g3[axis],axis,
+	     g3[axis] >= 3);
+  }
+
+  double xm,ym,zm;
+  data->lower(&xm,&ym,&zm);
+  double xp,yp,zp;
+  data->upper(&xp,&yp,&zp);
+  double h3[3];
+  field.cell_width(xm,xp,&h3[0],
+		   ym,yp,&h3[1],
+		   zm,zp,&h3[2]);
+
+  // If using comoving coordinates, multiply dx by a(n+1/2) as in
+  // SolveHydroEquations()
+
+  enzo_float a = 1, dadt;
+  if (comoving_coordinates_) {
+    enzo_block->CosmologyComputeExpansionFactor
+      (block->time() + 0.5*block->dt(), &a, &dadt);
+  }
+
+  const T dt = block->dt();
+
+  // Loop over directions, using the same Strang-type splitting as
+  // ppm_de()
+
+  const int ixyz = block->cycle() % RANK;
+
+  for (int n = ixyz; n < ixyz + RANK; n++) {
+
+    const int axis = n % RANK;
+
+    if (m3[axis] - 2*g3[axis] <= 1) continue;
+
+    sweep_<T> (axis, dt, T(dt/(a*h3[axis])),
+	       d, v3, te, a3, colour, m3, g3[axis]);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <typename T>
+void EnzoComputePpm::sweep_
+(int axis, T dt, T dtdx,
+ T * d, T * v3[3], T * te, T * a3[3],
+ std::vector<T *> & colour,
+ const int m3[3], int ghost)
+{
+  const T gamma = gamma_;
+  const T gm1   = gamma - 1;
+  const T gp1o2g = (gamma + 1) / (2*gamma);
+  const T pmin  = tiny;
+  const T dmin  = tiny;
+
+  const bool flatten = EnzoBlock::PPMFlatteningParameter;
+  const bool diffuse = EnzoBlock::PPMDiffusionParameter;
+
+  // pencils run along axis; lanes run along x unless axis is x, so
+  // that gathers for y and z sweeps read contiguous memory
+
+  const int il = (axis == 0) ? 1 : 0;
+  const int io = 3 - axis - il;
+
+  const int s3[3] = { 1, m3[0], m3[0]*m3[1] };
+
+  const int n  = m3[axis];
+  const int sa = s3[axis];
+  const int nl = m3[il];
+  const int sl = s3[il];
+  const int so = s3[io];
+
+  T * vn  = v3[axis];
+  T * vt1 = v3[(axis+1)%3];
+  T * vt2 = v3[(axis+2)%3];
+  T * an  = a3[axis];
+
+  // primitive quantities: density, normal velocity, transverse
+  // velocities, pressure, then colour mass fractions
+
+  const int nc = colour.size();
+  const int nq = 5 + nc;
+
+  const int num_pencils = m3[il]*m3[io];
+  const int nt = MAX(1, MIN(PPM_TILE_CELLS / n, num_pencils));
+  const int mt = n*nt;
+
+  // scratch arrays are indexed by i*nt + t for cell i of lane t
+
+  const int scratch_size = (4*nq + 3)*mt;
+  T * scratch = scratch_<T>(scratch_size);
+  for (int i = 0; i < scratch_size; i++) scratch[i] = T(0);
+
+  T * w    = scratch;           // cell-centered primitives
+  T * wl   = w  + nq*mt;        // left face states
+  T * wr   = wl + nq*mt;        // right face states
+  T * f    = wr + nq*mt;        // fluxes at left faces
+  T * cs   = f  + nq*mt;        // sound speed
+  T * flat = cs + mt;           // flattening coefficient
+  T * dm   = flat + mt;         // slopes; upwind side in Riemann solve
+
+  if ((int)tile_base_.size() < nt) tile_base_.resize(nt);
+  int * base = &tile_base_[0];
+
+  for (int p0 = 0; p0 < num_pencils; p0 += nt) {
+
+    const int ntl = MIN(nt, num_pencils - p0);
+
+    for (int t = 0; t < ntl; t++) {
+      const int p = p0 + t;
+      base[t] = (p % nl)*sl + (p / nl)*so;
+    }
+
+    //--------------------------------------------------
+    // Gather tile and convert to primitive variables
+    //--------------------------------------------------
+
+    for (int i = 0; i < n; i++) {
+      for (int t = 0; t < ntl; t++) {
+	const int k = base[t] + i*sa;
+	const int m = i*nt + t;
+	const T dk = MAX(d[k], dmin);
+	const T un = vn[k];
+	const T u1 = vt1 ? vt1[k] : T(0);
+	const T u2 = vt2 ? vt2[k] : T(0);
+	const T pk = gm1*dk*(te[k] - T(0.5)*(un*un + u1*u1 + u2*u2));
+	w[0*mt+m] = dk;
+	w[1*mt+m] = un;
+	w[2*mt+m] = u1;
+	w[3*mt+m] = u2;
+	w[4*mt+m] = MAX(pk, pmin);
+	cs[m] = sqrt(gamma*w[4*mt+m]/dk);
+      }
+    }
+    for (int ic = 0; ic < nc; ic++) {
+      T * wc = w + (5+ic)*mt;
+      for (int i = 0; i < n; i++) {
+	for (int t = 0; t < ntl; t++) {
+	  const int m = i*nt + t;
+	  wc[m] = colour[ic][base[t] + i*sa] / w[m];
+	}
+      }
+    }
+
+    //--------------------------------------------------
+    // Flattening coefficients near strong shocks (CW84 A.1)
+    //--------------------------------------------------
+
+    if (flatten) {
+      const T * p = w + 4*mt;
+      const T * u = w + 1*mt;
+      for (int i = 2; i < n-2; i++) {
+	for (int t = 0; t < ntl; t++) {
+	  const int m = i*nt + t;
+	  const T dp1 = p[m+nt]   - p[m-nt];
+	  const T dp2 = p[m+2*nt] - p[m-2*nt];
+	  const T z = fabs(dp1) / MAX(T(fabs(dp2)), pmin);
+	  const T ft = MAX(T(0), MIN(T(1), T(PPM_FLATTEN_OMEGA2)*
+				     (z - T(PPM_FLATTEN_OMEGA1))));
+	  const bool shock =
+	    (fabs(dp1) > T(PPM_FLATTEN_EPSILON)*MIN(p[m+nt],p[m-nt])) &&
+	    (u[m-nt] > u[m+nt]);
+	  flat[m] = shock ? ft : T(0);
+	}
+      }
+    }
+
+    //--------------------------------------------------
+    // Reconstruct parabolae and trace to time-averaged face states
+    //--------------------------------------------------
+
+    for (int q = 0; q < nq; q++) {
+
+      const T * aq = w  + q*mt;
+      T * al = wl + q*mt;
+      T * ar = wr + q*mt;
+
+      // monotonized central slopes (CW84 1.7-1.8)
+
+      for (int i = 1; i < n-1; i++) {
+	for (int t = 0; t < ntl; t++) {
+	  const int m = i*nt + t;
+	  const T dc = T(0.5)*(aq[m+nt] - aq[m-nt]);
+	  const T dl = aq[m]     - aq[m-nt];
+	  const T dr = aq[m+nt]  - aq[m];
+	  const T dlim = MIN(T(fabs(dc)), T(2)*MIN(T(fabs(dl)),T(fabs(dr))));
+	  dm[m] = (dl*dr > 0) ? ((dc >= 0) ? dlim : -dlim) : T(0);
+	}
+      }
+
+      // face values a(i+1/2) (CW84 1.6)
+
+      for (int i = 1; i < n-2; i++) {
+	for (int t = 0; t < ntl; t++) {
+	  const int m = i*nt + t;
+	  ar[m] = T(0.5)*(aq[m] + aq[m+nt]) - (dm[m+nt] - dm[m])/T(6);
+	}
+      }
+      for (int i = 2; i < n-2; i++) {
+	for (int t = 0; t < ntl; t++) {
+	  const int m = i*nt + t;
+	  al[m] = ar[m-nt];
+	}
+      }
+
+      // flatten, enforce monotonicity (CW84 1.10), and average over
+      // the domain of dependence of the fastest wave toward each face
+      // (CW84 1.12)
+
+      const T * u = w + 1*mt;
+
+      for (int i = 2; i < n-2; i++) {
+	for (int t = 0; t < ntl; t++) {
+	  const int m = i*nt + t;
+	  const T aa = aq[m];
+	  T aL = al[m];
+	  T aR = ar[m];
+	  if (flatten) {
+	    aL = flat[m]*aa + (1 - flat[m])*aL;
+	    aR = flat[m]*aa + (1 - flat[m])*aR;
+	  }
+	  T da = aR - aL;
+	  T a6 = T(6)*(aa - T(0.5)*(aL + aR));
+	  const bool extremum = ((aR - aa)*(aa - aL) <= 0);
+	  const T aL0 = aL;
+	  aL = extremum ? aa : ((da*a6 >  da*da) ? T(3)*aa - T(2)*aR  : aL);
+	  aR = extremum ? aa : ((-da*da > da*a6) ? T(3)*aa - T(2)*aL0 : aR);
+	  da = aR - aL;
+	  a6 = T(6)*(aa - T(0.5)*(aL + aR));
+	  const T sr = MIN(T(1), MAX(T(0),  (u[m] + cs[m])*dtdx));
+	  const T sl = MIN(T(1), MAX(T(0), -(u[m] - cs[m])*dtdx));
+	  ar[m] = aR - T(0.5)*sr*(da - (T(1) - T(2.0/3.0)*sr)*a6);
+	  al[m] = aL + T(0.5)*sl*(da + (T(1) - T(2.0/3.0)*sl)*a6);
+	}
+      }
+    }
+
+    for (int i = 2; i < n-2; i++) {
+      for (int t = 0; t < ntl; t++) {
+	const int m = i*nt + t;
+	wl[0*mt+m] = MAX(wl[0*mt+m], dmin);
+	wr[0*mt+m] = MAX(wr[0*mt+m], dmin);
+	wl[4*mt+m] = MAX(wl[4*mt+m], pmin);
+	wr[4*mt+m] = MAX(wr[4*mt+m], pmin);
+      }
+    }
+
+    //--------------------------------------------------
+    // Two-shock Riemann solve at faces i-1/2 (CW84 2.8-2.10)
+    //--------------------------------------------------
+
+    const int i_face_lo = ghost;
+    const int i_face_hi = n - ghost;
+
+    for (int i = i_face_lo; i <= i_face_hi; i++) {
+      for (int t = 0; t < ntl; t++) {
+	const int m  = i*nt + t;
+	const int ml = m - nt;
+
+	const T dl = wr[0*mt+ml];
+	const T ul = wr[1*mt+ml];
+	const T pl = wr[4*mt+ml];
+	const T dr = wl[0*mt+m];
+	const T ur = wl[1*mt+m];
+	const T pr = wl[4*mt+m];
+
+	const T cl = sqrt(gamma*pl*dl);
+	const T cr = sqrt(gamma*pr*dr);
+
+	T ps = MAX(pmin, (cr*pl + cl*pr - cl*cr*(ur - ul))/(cl + cr));
+
+	for (int iter = 0; iter < PPM_RIEMANN_ITER; iter++) {
+	  const T wwl = cl*sqrt(1 + gp1o2g*(ps/pl - 1));
+	  const T wwr = cr*sqrt(1 + gp1o2g*(ps/pr - 1));
+	  const T zl = 2*wwl*wwl*wwl/(wwl*wwl + cl*cl);
+	  const T zr = 2*wwr*wwr*wwr/(wwr*wwr + cr*cr);
+	  const T usl = ul - (ps - pl)/wwl;
+	  const T usr = ur + (ps - pr)/wwr;
+	  ps = MAX(pmin, ps - zl*zr*(usr - usl)/(zl + zr));
+	}
+
+	const T wwl = cl*sqrt(1 + gp1o2g*(ps/pl - 1));
+	const T wwr = cr*sqrt(1 + gp1o2g*(ps/pr - 1));
+	const T us = (wwl*ul + wwr*ur + pl - pr)/(wwl + wwr);
+
+	// sample the solution at x/t = 0 on the upwind side of the
+	// contact, reflecting right-side waves so one set of tests
+	// applies to both
+
+	const bool left = (us >= 0);
+	const T sgn = left ? T(1) : T(-1);
+	const T d0 = left ? dl  : dr;
+	const T u0 = left ? ul  : ur;
+	const T p0 = left ? pl  : pr;
+	const T w0 = left ? wwl : wwr;
+	const T c0 = sqrt(gamma*p0/d0);
+
+	const T ds  = MAX(dmin, d0/(1 - d0*(ps - p0)/(w0*w0)));
+	const T css = sqrt(gamma*ps/ds);
+
+	const T shock_speed = sgn*u0 - w0/d0;
+	const T head  = sgn*u0 - c0;
+	const T tail  = sgn*us - css;
+	const T denom = MAX(tail - head, T(tiny));
+	const T frac  = MIN(T(1), MAX(T(0), -head/denom));
+
+	const T ws = (ps >= p0) ?
+	  ((shock_speed < 0) ? T(1) : T(0)) :
+	  ((head >= 0) ? T(0) : ((tail < 0) ? T(1) : frac));
+
+	const T db = d0 + ws*(ds - d0);
+	const T ub = u0 + ws*(us - u0);
+	const T pb = p0 + ws*(ps - p0);
+	const T v1 = left ? wr[2*mt+ml] : wl[2*mt+m];
+	const T v2 = left ? wr[3*mt+ml] : wl[3*mt+m];
+
+	const T fd = db*ub;
+	f[0*mt+m] = fd;
+	f[1*mt+m] = fd*ub + pb;
+	f[2*mt+m] = fd*v1;
+	f[3*mt+m] = fd*v2;
+	f[4*mt+m] = (gamma/gm1*pb + T(0.5)*db*(ub*ub + v1*v1 + v2*v2))*ub;
+	dm[m] = left ? T(1) : T(0);
+      }
+    }
+
+    for (int ic = 0; ic < nc; ic++) {
+      const int q = 5 + ic;
+      for (int i = i_face_lo; i <= i_face_hi; i++) {
+	for (int t = 0; t < ntl; t++) {
+	  const int m = i*nt + t;
+	  f[q*mt+m] = f[m] * (dm[m]*wr[q*mt+m-nt] + (1-dm[m])*wl[q*mt+m]);
+	}
+      }
+    }
+
+    //--------------------------------------------------
+    // Artificial diffusion in compressions (CW84 4.4-4.5, normal
+    // divergence only)
+    //--------------------------------------------------
+
+    if (diffuse) {
+      for (int i = i_face_lo; i <= i_face_hi; i++) {
+	for (int t = 0; t < ntl; t++) {
+	  const int m  = i*nt + t;
+	  const int ml = m - nt;
+	  const T nu = T(PPM_DIFFUSION_K)*
+	    MAX(T(0), w[1*mt+ml] - w[1*mt+m]);
+	  const T dL = w[ml], dR = w[m];
+	  const T eL = w[4*mt+ml]/gm1 + T(0.5)*dL*
+	    (w[1*mt+ml]*w[1*mt+ml] + w[2*mt+ml]*w[2*mt+ml] +
+	     w[3*mt+ml]*w[3*mt+ml]);
+	  const T eR = w[4*mt+m]/gm1 + T(0.5)*dR*
+	    (w[1*mt+m]*w[1*mt+m] + w[2*mt+m]*w[2*mt+m] +
+	     w[3*mt+m]*w[3*mt+m]);
+	  f[0*mt+m] -= nu*(dR - dL);
+	  f[1*mt+m] -= nu*(dR*w[1*mt+m] - dL*w[1*mt+ml]);
+	  f[2*mt+m] -= nu*(dR*w[2*mt+m] - dL*w[2*mt+ml]);
+	  f[3*mt+m] -= nu*(dR*w[3*mt+m] - dL*w[3*mt+ml]);
+	  f[4*mt+m] -= nu*(eR - eL);
+	  for (int q = 5; q < nq; q++) {
+	    f[q*mt+m] -= nu*(dR*w[q*mt+m] - dL*w[q*mt+ml]);
+	  }
+	}
+      }
+    }
+
+    //--------------------------------------------------
+    // Conservative update of active cells and scatter
+    //--------------------------------------------------
+
+    for (int i = ghost; i < n - ghost; i++) {
+      for (int t = 0; t < ntl; t++) {
+	const int k  = base[t] + i*sa;
+	const int m  = i*nt + t;
+	const int mr = m + nt;
+
+	const T dk = w[m];
+	const T un = w[1*mt+m];
+	const T u1 = w[2*mt+m];
+	const T u2 = w[3*mt+m];
+	const T ek = w[4*mt+m]/gm1 + T(0.5)*dk*(un*un + u1*u1 + u2*u2);
+
+	const T dn  = MAX(dmin, dk - dtdx*(f[0*mt+mr] - f[0*mt+m]));
+	const T mn  = dk*un     - dtdx*(f[1*mt+mr] - f[1*mt+m]);
+	const T m1  = dk*u1     - dtdx*(f[2*mt+mr] - f[2*mt+m]);
+	const T m2  = dk*u2     - dtdx*(f[3*mt+mr] - f[3*mt+m]);
+	const T en  = ek        - dtdx*(f[4*mt+mr] - f[4*mt+m]);
+
+	T vnn = mn/dn;
+	const T v1n = m1/dn;
+	const T v2n = m2/dn;
+	T ten = en/dn;
+
+	if (an) {
+	  const T vg = vnn + dt*an[k];
+	  ten += T(0.5)*(vg*vg - vnn*vnn);
+	  vnn = vg;
+	}
+
+	const T ke = T(0.5)*(vnn*vnn + v1n*v1n + v2n*v2n);
+	ten = MAX(ten, ke + pmin/(gm1*dn));
+
+	d[k]  = dn;
+	vn[k] = vnn;
+	if (vt1) vt1[k] = v1n;
+	if (vt2) vt2[k] = v2n;
+	te[k] = ten;
+      }
+    }
+
+    for (int ic = 0; ic < nc; ic++) {
+      const int q = 5 + ic;
+      for (int i = ghost; i < n - ghost; i++) {
+	for (int t = 0; t < ntl; t++) {
+	  const int m  = i*nt + t;
+	  colour[ic][base[t] + i*sa] = w[m]*w[q*mt+m]
+	    - dtdx*(f[q*mt+m+nt] - f[q*mt+m]);
+	}
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <typename T>
+T * EnzoComputePpm::scratch_ (int n)
+{
+  const size_t size = n*sizeof(T);
+  if (scratch_buffer_.size() < size) scratch_buffer_.resize(size);
+  return (T *) &scratch_buffer_[0];
+}
@@ -0,0 +1,89 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoComputePpm.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    [\ref Enzo] Declaration of the C++ PPM hydro solver
+
+#ifndef ENZO_ENZO_COMPUTE_PPM_HPP
+#define ENZO_ENZO_COMPUTE_PPM_HPP
+
+class EnzoComputePpm : public Compute {
+
+  /// @class    EnzoComputePpm
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Directionally-split PPM solver operating
+  /// in place on a Block's fields; a C++ alternative to ppm_de()
+  ///
+  /// Each sweep gathers a tile of pencils into scratch arrays laid
+  /// out with the pencil index fastest ("lanes"), so that the
+  /// reconstruction, two-shock Riemann solve and update are
+  /// branch-free loops over contiguous lanes that the compiler can
+  /// vectorize.  Uses the PPM parameters stored in EnzoBlock.
+  /// Fields are accessed through FieldHandles resolved at
+  /// construction, and the scratch arrays are kept between sweeps.
+
+public: // interface
+
+  /// Create a new EnzoComputePpm object
+  EnzoComputePpm(const FieldDescr * field_descr,
+		 double gamma,
+		 int comoving_coordinates);
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoComputePpm);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoComputePpm (CkMigrateMessage *m) {}
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Advance the Block's hydro fields by the Block's dt
+  virtual void compute( Block * block) throw();
+
+protected: // functions
+
+  /// Select the rank-specialized solver for precision T
+  template <typename T>
+  void compute_(Block * block);
+
+  /// Apply the sweeps for the given precision and rank
+  template <typename T, int RANK>
+  void compute_rank_(Block * block);
+
+  /// Update all pencils along the given axis
+  template <typename T>
+  void sweep_ (int axis, T dt, T dtdx,
+	       T * d, T * v3[3], T * te, T * a3[3],
+	       std::vector<T *> & colour,
+	       const int m3[3], int ghost);
+
+  /// Return scratch storage for n values of type T
+  template <typename T>
+  T * scratch_ (int n);
+
+protected: // attributes
+
+  double gamma_;
+  int comoving_coordinates_;
+
+  /// Fields accessed by the solver
+  FieldHandle density_;
+  FieldHandle total_energy_;
+  FieldHandle velocity_[3];
+  FieldHandle acceleration_[3];
+
+  /// Fields in the "colour" group, advected as mass fractions
+  std::vector<FieldHandle> colour_;
+
+  /// Scratch arrays for a tile of pencils, reused between sweeps and
+  /// Blocks and not pup'ed
+  std::vector<char> scratch_buffer_;
+
+  /// Array offset of each pencil in the current tile (not pup'ed)
+  std::vector<int> tile_base_;
+
+};
+
+#endif /* ENZO_ENZO_COMPUTE_PPM_HPP */
@@ -13,7 +13,8 @@
 EnzoConfig::EnzoConfig() throw ()
 #ifdef CONFIG_USE_GRACKLE
   : method_grackle_units(),
-    method_grackle_chemistry()
+    method_grackle_chemistry(),
+    method_grackle_batch_size(0)
 #endif
 {
 }
@@ -41,11 +42,14 @@ void EnzoConfig::pup (PUP::er &p)
   p | ppm_dual_energy_eta_1;
   p | ppm_dual_energy_eta_2;
   p | ppm_flattening;
+  p | ppm_flux_correct;
   p | ppm_minimum_pressure_support_parameter;
   p | ppm_number_density_floor;
   p | ppm_pressure_floor;
   p | ppm_pressure_free;
+  p | ppm_solver;
   p | ppm_steepening;
+  p | ppm_sweep_threads;
   p | ppm_temperature_floor;
   p | ppm_use_minimum_pressure_support;
 
@@ -72,9 +76,26 @@ void EnzoConfig::pup (PUP::er &p)
   p | interpolation_method;
 
   p | method_heat_alpha;
+  p | method_heat_substeps;
+
+  p | method_heat_implicit_alpha;
+  p | method_heat_implicit_theta;
+  p | method_heat_implicit_dt;
+  p | method_heat_implicit_iter_max;
+  p | method_heat_implicit_res_tol;
+  p | method_heat_implicit_monitor_iter;
+
+  p | method_muscl_ghost_depth;
 
   p | method_null_dt;
   p | method_turbulence_edot;
+  p | method_turbulence_driving;
+  p | method_turbulence_driving_kmin;
+  p | method_turbulence_driving_kmax;
+  p | method_turbulence_driving_correlation_time;
+  p | method_turbulence_driving_update_interval;
+  p | method_turbulence_driving_seed;
+  p | method_turbulence_store_temperature;
 
   p | method_gravity_cg_grav_const;
   p | method_gravity_cg_iter_max;
@@ -110,6 +131,7 @@ void EnzoConfig::pup (PUP::er &p)
 
   p | method_grackle_units;
   p | method_grackle_chemistry;
+  p | method_grackle_batch_size;
 
 #endif /* CONFIG_USE_GRACKLE */
 
@@ -142,6 +164,8 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Method:ppm:dual_energy_eta_2", 0.1);
   ppm_flattening = p->value_integer
     ("Method:ppm:flattening", 3);
+  ppm_flux_correct = p->value_logical
+    ("Method:ppm:flux_correct", false);
   ppm_minimum_pressure_support_parameter = p->value_integer
     ("Method:ppm:minimum_pressure_support_parameter",100);
   ppm_number_density_floor = p->value_float
@@ -150,8 +174,12 @@ void EnzoConfig::read(Parameters * p) throw()
     ("Method:ppm:pressure_floor", floor_default);
   ppm_pressure_free = p->value_logical
     ("Method:ppm:pressure_free",false);
+  ppm_solver = p->value_string
+    ("Method:ppm:solver","fortran");
   ppm_steepening = p->value_logical 
     ("Method:ppm:steepening", false);
+  ppm_sweep_threads = p->value_integer
+    ("Method:ppm:sweep_threads", 1);
   ppm_temperature_floor = p->value_float
     ("Method:ppm:temperature_floor", floor_default);
   ppm_use_minimum_pressure_support = p->value_logical
@@ -220,12 +248,65 @@ void EnzoConfig::read(Parameters * p) throw()
   method_turbulence_mach_number = p->value_float 
     ("Method:turbulence:mach_number",0.0);
 
+  // "field": read driving_[xyz] fields; "spectral": compute from modes
+  method_turbulence_driving = p->value_string
+    ("Method:turbulence:driving","field");
+
+  method_turbulence_driving_kmin = p->value_float
+    ("Method:turbulence:driving_kmin",1.0);
+
+  method_turbulence_driving_kmax = p->value_float
+    ("Method:turbulence:driving_kmax",2.0);
+
+  method_turbulence_driving_correlation_time = p->value_float
+    ("Method:turbulence:driving_correlation_time",
+     std::numeric_limits<double>::max());
+
+  // mode amplitudes are advanced at multiples of the update interval
+  // in simulation time, independent of the cycle's dt
+  method_turbulence_driving_update_interval = p->value_float
+    ("Method:turbulence:driving_update_interval",
+     0.1*method_turbulence_driving_correlation_time);
+
+  method_turbulence_driving_seed = p->value_integer
+    ("Method:turbulence:driving_seed",12398);
+
+  // Write the temperature and pressure fields computed with the
+  // turbulence statistics
+  method_turbulence_store_temperature = p->value_logical
+    ("Method:turbulence:store_temperature",true);
+
   interpolation_method = p->value_string 
     ("Field:interpolation_method","SecondOrderA");
 
   method_heat_alpha = p->value_float 
     ("Method:heat:alpha",1.0);
 
+  method_heat_substeps = p->value_integer
+    ("Method:heat:substeps",1);
+
+  method_heat_implicit_alpha = p->value_float
+    ("Method:heat_implicit:alpha",1.0);
+
+  // theta = 1.0: backward Euler; theta = 0.5: Crank-Nicolson
+  method_heat_implicit_theta = p->value_float
+    ("Method:heat_implicit:theta",1.0);
+
+  method_heat_implicit_dt = p->value_float
+    ("Method:heat_implicit:dt",std::numeric_limits<double>::max());
+
+  method_heat_implicit_iter_max = p->value_integer
+    ("Method:heat_implicit:iter_max",100);
+
+  method_heat_implicit_res_tol = p->value_float
+    ("Method:heat_implicit:res_tol",1e-6);
+
+  method_heat_implicit_monitor_iter = p->value_integer
+    ("Method:heat_implicit:monitor_iter",0);
+
+  method_muscl_ghost_depth = p->value_integer
+    ("Method:muscl:ghost_depth",2);
+
   method_null_dt = p->value_float 
     ("Method:null:dt",std::numeric_limits<double>::max());
 
@@ -391,6 +472,11 @@ void EnzoConfig::read(Parameters * p) throw()
     method_grackle_chemistry.UVbackground = p->value_integer
       ("Method:grackle:UVbackground",method_grackle_chemistry.UVbackground);
 
+    // 0: one Grackle call per Block; > 0: gather all leaf Blocks on
+    // the process and call Grackle on at most batch_size cells
+    method_grackle_batch_size = p->value_integer
+      ("Method:grackle:batch_size",0);
+
     // initialize chemistry data: required here since EnzoMethodGrackle may not be used
 
     const gr_float a_value = 
@@ -58,11 +58,14 @@ public: // attributes
   double                     ppm_dual_energy_eta_1;
   double                     ppm_dual_energy_eta_2;
   int                        ppm_flattening;
+  bool                       ppm_flux_correct;
   int                        ppm_minimum_pressure_support_parameter;
   double                     ppm_number_density_floor;
   double                     ppm_pressure_floor;
   bool                       ppm_pressure_free;
+  std::string                ppm_solver;
   bool                       ppm_steepening;
+  int                        ppm_sweep_threads;
   double                     ppm_temperature_floor;
   bool                       ppm_use_minimum_pressure_support;
   double                     ppm_mol_weight;
@@ -94,6 +97,18 @@ public: // attributes
 
   // EnzoMethodHeat
   double                     method_heat_alpha;
+  int                        method_heat_substeps;
+
+  // EnzoMethodHeatImplicit
+  double                     method_heat_implicit_alpha;
+  double                     method_heat_implicit_theta;
+  double                     method_heat_implicit_dt;
+  int                        method_heat_implicit_iter_max;
+  double                     method_heat_implicit_res_tol;
+  int                        method_heat_implicit_monitor_iter;
+
+  // EnzoMethodMuscl
+  int                        method_muscl_ghost_depth;
 
   // EnzoMethodNull
   double                     method_null_dt;
@@ -101,6 +116,13 @@ public: // attributes
   // EnzoMethodTurbulence
   double                     method_turbulence_edot;
   double                     method_turbulence_mach_number;
+  std::string                method_turbulence_driving;
+  double                     method_turbulence_driving_kmin;
+  double                     method_turbulence_driving_kmax;
+  double                     method_turbulence_driving_correlation_time;
+  double                     method_turbulence_driving_update_interval;
+  int                        method_turbulence_driving_seed;
+  bool                       method_turbulence_store_temperature;
 
   // EnzoMethodGravityCg
   int                        method_gravity_cg_iter_max;
@@ -141,6 +163,7 @@ public: // attributes
 
   code_units      method_grackle_units;
   chemistry_data  method_grackle_chemistry;
+  int             method_grackle_batch_size;
 
 #endif /* CONFIG_USE_GRACKLE */
 
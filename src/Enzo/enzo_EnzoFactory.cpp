@@ -34,7 +34,8 @@ CProxy_Block EnzoFactory::create_block_array
  int nbx, int nby, int nbz,
  int nx, int ny, int nz,
  int num_field_blocks,
- bool testing
+ bool testing,
+ bool insert_blocks
  ) const throw()
 {
   TRACE7("EnzoFactory::create_block_array(na(%d %d %d) n(%d %d %d) num_field_blocks %d",	 nbx,nby,nbz,nx,ny,nz,num_field_blocks);
@@ -53,6 +54,8 @@ CProxy_Block EnzoFactory::create_block_array
   TRACE_CHARM("ckNew(nbx,nby,nbz)");
   enzo_block_array = CProxy_EnzoBlock::ckNew(opts);
 
+  if (! insert_blocks) return enzo_block_array;
+
   int count_adapt;
 
   int    cycle = 0;
@@ -166,6 +169,38 @@ void EnzoFactory::create_subblock_array
 
 //----------------------------------------------------------------------
 
+void EnzoFactory::insert_block_
+(CProxy_Block * block_array,
+ Index index,
+ int nx, int ny, int nz,
+ int num_field_blocks,
+ bool testing
+ ) const throw()
+{
+  CProxy_EnzoBlock * enzo_block_array = static_cast<CProxy_EnzoBlock*> (block_array);
+
+  int count_adapt;
+
+  int    cycle = 0;
+  double time  = 0.0;
+  double dt    = 0.0;
+  int num_face_level = 0;
+  int * face_level = 0;
+
+  (*enzo_block_array)[index].insert 
+    (index,
+     nx,ny,nz,
+     num_field_blocks,
+     count_adapt = 0,
+     cycle, time, dt,
+     0,NULL,op_array_copy,
+     num_face_level, face_level,
+     testing);
+  // --------------------------------------------------
+}
+
+//----------------------------------------------------------------------
+
 Block * EnzoFactory::create_block
 (
  CProxy_Block * block_array,
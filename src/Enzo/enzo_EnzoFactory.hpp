@@ -37,7 +37,8 @@ public: // interface
   (int nbx, int nby, int nbz,
    int nx, int ny, int nz,
    int num_field_blocks,
-   bool testing=false) const throw();
+   bool testing=false,
+   bool insert_blocks=true) const throw();
 
   /// Create a new coarse blocks under the Block array.  For Multigrid
   ///  solvers.  Arguments are the same as create_block_array(), plus
@@ -65,6 +66,17 @@ public: // interface
    bool testing=false,
    Simulation * simulation = 0) const throw();
 
+protected: // functions
+
+  /// Insert an EnzoBlock at index into the Block array, for
+  /// Factory::insert_block_array_local()
+  virtual void insert_block_
+  (CProxy_Block * block_array,
+   Index index,
+   int nx, int ny, int nz,
+   int num_field_blocks,
+   bool testing) const throw();
+
 };
 
 #endif /* ENZO_ENZO_FACTORY_HPP */
@@ -83,15 +83,6 @@ void EnzoInitialTurbulence::enforce_block
 	 "Missing Field 'pressure'",p);
   ASSERT("EnzoInitializeTurbulence::enforce_block()",
 	 "Missing Field 'temperature'",t);
-  if (rank >= 1)
-    ASSERT("EnzoInitializeTurbulence::enforce_block()",
-	   "Missing Field 'driving_x'", a3[0]);
-  if (rank >= 2)
-    ASSERT("EnzoInitializeTurbulence::enforce_block()",
-	   "Missing Field 'driving_y'",  a3[1]);
-  if (rank >= 3)
-    ASSERT("EnzoInitializeTurbulence::enforce_block()",
-	   "Missing Field 'driving_z'",  a3[2]);
   if (rank >= 1)
     ASSERT("EnzoInitializeTurbulence::enforce_block()",
 	   "Missing Field 'velocity_x'", v3[0]);
@@ -186,9 +177,12 @@ void EnzoInitialTurbulence::enforce_block
        &o3[0],&o3[1],&o3[2]);
   }
 
-  if (rank >= 1) for (int i=0; i<ndx*ndy*ndz; i++) a3[0][i] = v3[0][i];
-  if (rank >= 2) for (int i=0; i<ndx*ndy*ndz; i++) a3[1][i] = v3[1][i];
-  if (rank >= 3) for (int i=0; i<ndx*ndy*ndz; i++) a3[2][i] = v3[2][i];
+  // driving fields are optional, since spectral driving computes the
+  // acceleration in EnzoMethodTurbulence
+
+  for (int id=0; id<rank; id++) {
+    if (a3[id]) for (int i=0; i<ndx*ndy*ndz; i++) a3[id][i] = v3[id][i];
+  }
 
 
   for (int iz=0; iz<ndz; iz++) {
@@ -0,0 +1,131 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMatrixDiffusion.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implementation of the implicit diffusion operator EnzoMatrixDiffusion
+
+#include "enzo.hpp"
+
+//======================================================================
+
+void EnzoMatrixDiffusion::matvec (int id_y, int id_x, Block * block,
+				  int g0) throw()
+{
+  Data * data = block->data();
+  Field field = data->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  data->field_cell_width(&hx_,&hy_,&hz_);
+
+  rank_ = block->rank();
+
+  int precision = field.precision(0);
+
+  void * X = field.values(id_x);
+  void * Y = field.values(id_y);
+
+  if      (precision == precision_single)    
+    matvec_((float *)(Y),(float *)(X),g0);
+  else if (precision == precision_double)    
+    matvec_((double *)(Y),(double *)(X),g0);
+  else if (precision == precision_quadruple) 
+    matvec_((long double *)(Y),(long double *)(X),g0);
+  else 
+    ERROR1("EnzoMatrixDiffusion::matvec()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMatrixDiffusion::diagonal (int id_x, Block * block, int g0) throw()
+{
+  Data * data = block->data();
+  Field field = data->field();
+
+  field.dimensions (id_x,&mx_,&my_,&mz_);
+  data->field_cell_width(&hx_,&hy_,&hz_);
+
+  rank_ = block->rank();
+
+  int precision = field.precision(0);
+
+  void * X = field.values(id_x);
+
+  if      (precision == precision_single)    
+    diagonal_((float *)(X),g0);
+  else if (precision == precision_double)    
+    diagonal_((double *)(X),g0);
+  else if (precision == precision_quadruple) 
+    diagonal_((long double *)(X),g0);
+  else 
+    ERROR1("EnzoMatrixDiffusion::diagonal()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoMatrixDiffusion::matvec_ (T * Y, T * X, int g0) const throw()
+{
+  const int idx = 1;
+  const int idy = mx_;
+  const int idz = mx_*my_;
+
+  const T cx = coefficient_ / (hx_*hx_);
+  const T cy = coefficient_ / (hy_*hy_);
+  const T cz = coefficient_ / (hz_*hz_);
+
+  if (rank_ == 1) {
+
+    for (int ix=g0; ix<mx_-g0; ix++) {
+      const int i = ix;
+      Y[i] = X[i] - cx * ( X[i-idx] - 2.0*X[i] + X[i+idx] );
+    }
+
+  } else if (rank_ == 2) {
+
+    for   (int iy=g0; iy<my_-g0; iy++) {
+      for (int ix=g0; ix<mx_-g0; ix++) {
+	const int i = ix + mx_*iy;
+	Y[i] = X[i] 
+	  - cx * ( X[i+idx] - 2.0*X[i] + X[i-idx])
+	  - cy * ( X[i+idy] - 2.0*X[i] + X[i-idy]);
+      }
+    }
+
+  } else if (rank_ == 3) {
+
+    for     (int iz=g0; iz<mz_-g0; iz++) {
+      for   (int iy=g0; iy<my_-g0; iy++) {
+	for (int ix=g0; ix<mx_-g0; ix++) {
+	  const int i = ix + mx_*(iy + my_*iz);
+	  Y[i] = X[i]
+	    - cx * ( X[i+idx] - 2.0*X[i] + X[i-idx])
+	    - cy * ( X[i+idy] - 2.0*X[i] + X[i-idy])
+	    - cz * ( X[i+idz] - 2.0*X[i] + X[i-idz]);
+	}
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoMatrixDiffusion::diagonal_ (T * X, int g0) const throw()
+{
+  double d = 1.0 + 2.0*coefficient_ / (hx_*hx_);
+  if (rank_ >= 2) d += 2.0*coefficient_ / (hy_*hy_);
+  if (rank_ >= 3) d += 2.0*coefficient_ / (hz_*hz_);
+
+  const int iy0 = (rank_ >= 2) ? g0 : 0;
+  const int iz0 = (rank_ >= 3) ? g0 : 0;
+
+  for     (int iz=iz0; iz<mz_-iz0; iz++) {
+    for   (int iy=iy0; iy<my_-iy0; iy++) {
+      for (int ix=g0; ix<mx_-g0; ix++) {
+	const int i = ix + mx_*(iy + my_*iz);
+	X[i] = d;
+      }
+    }
+  }
+}
@@ -0,0 +1,85 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMatrixDiffusion.hpp 
+/// @author   James Bordner (jobordner@ucsd.edu) 
+/// @date     2026-10-19
+/// @brief    [\ref Compute] Declaration of the EnzoMatrixDiffusion class
+
+#ifndef COMPUTE_MATRIX_DIFFUSION_HPP
+#define COMPUTE_MATRIX_DIFFUSION_HPP
+
+class EnzoMatrixDiffusion : public Matrix 
+{
+  /// @class    EnzoMatrixDiffusion
+  /// @ingroup  Compute
+  /// @brief    [\ref Compute] Implicit diffusion operator A = I - c*L,
+  /// where L is the discrete Laplacian of EnzoMatrixLaplace and c =
+  /// theta*dt*alpha.  A is symmetric positive definite for c >= 0.
+
+public: // interface
+
+  /// Create a new EnzoMatrixDiffusion
+  EnzoMatrixDiffusion () throw()
+    : coefficient_(0.0)
+  {}
+
+  /// Destructor
+  virtual ~EnzoMatrixDiffusion() throw()
+  {}
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoMatrixDiffusion);
+
+  /// CHARM++ migration constructor
+  EnzoMatrixDiffusion(CkMigrateMessage *m) {}
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  { TRACEPUP;
+    PUP::able::pup(p);
+    p | mx_;
+    p | my_;
+    p | mz_;
+    p | hx_;
+    p | hy_;
+    p | hz_;
+    p | rank_;
+    p | coefficient_;
+  }
+
+  /// Set the coefficient c of the Laplacian
+  void set_coefficient (double coefficient) throw()
+  { coefficient_ = coefficient; }
+
+  /// Return the coefficient c of the Laplacian
+  double coefficient () const throw()
+  { return coefficient_; }
+
+public: // virtual functions
+
+  /// Apply the matrix to a vector Y <-- A*X
+  virtual void matvec (int id_y, int id_x, Block * block, int g0=1) throw();
+
+  /// Extract the diagonal into the given field
+  virtual void diagonal (int id_x, Block * block, int g0=1) throw();
+
+protected: // functions
+
+  template <class T>
+  void matvec_ (T * Y, T * X, int g0) const throw();
+
+  template <class T>
+  void diagonal_ (T * X, int g0) const throw();
+
+protected: // attributes
+
+  int mx_, my_, mz_;
+  double hx_, hy_, hz_;
+  int rank_;
+
+  /// Coefficient c of the Laplacian
+  double coefficient_;
+
+};
+
+#endif /* COMPUTE_MATRIX_DIFFUSION_HPP */
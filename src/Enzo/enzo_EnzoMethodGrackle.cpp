@@ -10,15 +10,53 @@
 
 //----------------------------------------------------------------------
 
+// Field names, ordered by grackle_field_enum
+
+static const char * grackle_field_name[num_grackle_fields] = {
+  "density",
+  "internal_energy",
+  "velocity_x",
+  "velocity_y",
+  "velocity_z",
+  "HI_density",
+  "HII_density",
+  "HM_density",
+  "HeI_density",
+  "HeII_density",
+  "HeIII_density",
+  "H2I_density",
+  "H2II_density",
+  "DI_density",
+  "DII_density",
+  "HDI_density",
+  "e_density",
+  "metal_density",
+  "cooling_time",
+  "temperature",
+  "pressure",
+  "gamma"
+};
+
+//----------------------------------------------------------------------
+
 EnzoMethodGrackle::EnzoMethodGrackle 
-(EnzoConfig * config)
-  : Method()
+(const FieldDescr * field_descr,
+ EnzoConfig * config)
+  : Method(),
+    field_(num_grackle_fields)
 #ifdef CONFIG_USE_GRACKLE
   , chemistry_(0),
-    units_(0)
+    units_(0),
+    batch_size_(config->method_grackle_batch_size),
+    batch_block_(),
+    batch_values_(num_grackle_fields)
 #endif /* CONFIG_USE_GRACKLE */
 
 {
+  for (int i=0; i<num_grackle_fields; i++) {
+    field_[i] = FieldHandle(field_descr,grackle_field_name[i]);
+  }
+
 #ifdef CONFIG_USE_GRACKLE
 
   /// Initialize default Refresh
@@ -58,8 +96,11 @@ void EnzoMethodGrackle::pup (PUP::er &p)
 
   Method::pup(p);
 
+  p | field_;
+
   p | *chemistry_;
   p | *units_;
+  p | batch_size_;
 
 #endif /* CONFIG_USE_GRACKLE */
 
@@ -70,8 +111,6 @@ void EnzoMethodGrackle::pup (PUP::er &p)
 void EnzoMethodGrackle::compute ( Block * block) throw()
 {
 
-  if (!block->is_leaf()) return;
-
 #ifndef CONFIG_USE_GRACKLE
 
   ERROR("EnzoMethodGrackle::compute()",
@@ -80,52 +119,188 @@ void EnzoMethodGrackle::compute ( Block * block) throw()
 
 #else /* CONFIG_USE_GRACKLE */
 
-  initialize_(block);
+  if (batch_size_ > 0) {
+    // compute_done() is called when the batch is solved
+    compute_batch_(block);
+    return;
+  }
+
+  if (block->is_leaf()) compute_block_(block);
+
+#endif /* CONFIG_USE_GRACKLE */
+
+  EnzoBlock * enzo_block = static_cast<EnzoBlock*> (block);
+
+  enzo_block->compute_done();
+
+}
+
+//----------------------------------------------------------------------
+
+#ifdef CONFIG_USE_GRACKLE
 
+void EnzoMethodGrackle::compute_block_ ( Block * block) throw()
+{
   Field field = block->data()->field();
 
   // ASSUMES ALL ARRAYS ARE THE SAME SIZE
-  gr_int m[3];
-  array_dimension (0,m,m+1,m+2);
+  int mx,my,mz;
+  field.dimensions (0,&mx,&my,&mz);
+  gr_int m[3] = {mx,my,mz};
 
   int gx,gy,gz;
-  ghost_depth (0,&gx,&gy,&gz);
+  field.ghost_depth (0,&gx,&gy,&gz);
 
   int nx,ny,nz;
-  block_size (&nx,&ny,&nz);
+  field.size (&nx,&ny,&nz);
 
   gr_int grid_start[3] = {gx,      gy,      gz};
   gr_int grid_end[3]   = {gx+nx-1, gy+ny-1, gz+nz-1} ;
 
+  gr_float * values[num_grackle_fields];
+  for (int i=0; i<num_grackle_fields; i++) {
+    values[i] = values_(field,i);
+  }
+
+  solve_ (values, block->rank(), m, grid_start, grid_end, block->dt());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::compute_batch_ ( Block * block) throw()
+{
+  // Append the Block's active cells to the batch
+
+  if (block->is_leaf()) {
+    const int n = batch_values_[grackle_density].size();
+    batch_copy_ (block, n, true);
+  }
+
+  batch_block_.push_back(block);
+
+  // Wait until every Block on this process has been added
+
+  const size_t num_blocks = block->simulation()->hierarchy()->num_blocks();
+
+  if (batch_block_.size() < num_blocks) return;
+
+  // Solve the batch as one-dimensional arrays of at most batch_size_
+  // cells.  The Method does not allow subcycling, so all Blocks have
+  // the same dt
+
+  const int n = batch_values_[grackle_density].size();
+
+  for (int i0=0; i0<n; i0+=batch_size_) {
+
+    const int n0 = std::min(batch_size_, n - i0);
+
+    gr_int m[3]          = {n0,   1, 1};
+    gr_int grid_start[3] = {0,    0, 0};
+    gr_int grid_end[3]   = {n0-1, 0, 0};
+
+    gr_float * values[num_grackle_fields];
+    for (int i=0; i<num_grackle_fields; i++) {
+      values[i] = batch_values_[i].empty() ? NULL : &batch_values_[i][i0];
+    }
+
+    solve_ (values, 1, m, grid_start, grid_end, block->dt());
+  }
+
+  // Copy the results back to the Blocks, and continue all Blocks
+
+  std::vector<Block *> batch_block;
+  batch_block.swap(batch_block_);
+
+  int offset = 0;
+  for (size_t ib=0; ib<batch_block.size(); ib++) {
+    if (batch_block[ib]->is_leaf()) {
+      offset += batch_copy_ (batch_block[ib], offset, false);
+    }
+  }
+
+  for (int i=0; i<num_grackle_fields; i++) batch_values_[i].clear();
+
+  for (size_t ib=0; ib<batch_block.size(); ib++) {
+    static_cast<EnzoBlock*> (batch_block[ib])->compute_done();
+  }
+}
+
+//----------------------------------------------------------------------
+
+int EnzoMethodGrackle::batch_copy_
+(Block * block, int offset, bool gather) throw()
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions (0,&mx,&my,&mz);
+
+  int gx,gy,gz;
+  field.ghost_depth (0,&gx,&gy,&gz);
+
+  int nx,ny,nz;
+  field.size (&nx,&ny,&nz);
+
+  const int n = nx*ny*nz;
+
+  for (int index=0; index<num_grackle_fields; index++) {
+
+    gr_float * values = values_(field,index);
+
+    if (values == NULL) continue;
+
+    std::vector<gr_float> & batch = batch_values_[index];
+
+    if (gather) batch.resize(offset + n);
+
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+	gr_float * row   = values + gx + mx*(iy+gy + my*(iz+gz));
+	gr_float * batch_row = &batch[offset + nx*(iy + ny*iz)];
+	if (gather) {
+	  for (int ix=0; ix<nx; ix++) batch_row[ix] = row[ix];
+	} else {
+	  for (int ix=0; ix<nx; ix++) row[ix] = batch_row[ix];
+	}
+      }
+    }
+  }
+
+  return n;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::solve_
+(gr_float ** values,
+ gr_int rank, gr_int * m, gr_int * grid_start, gr_int * grid_end,
+ double dt) throw()
+{
   // ASSUMES COSMOLOGY = false
   double a_value = 1.0;
 
-  gr_int rank = this->rank();
-
-  gr_float * density       = (gr_float *) field.values("density");
-  gr_float * energy        = (gr_float *) field.values("internal_energy");
-  gr_float * velocity_x    = (gr_float *) field.values("velocity_x");
-  gr_float * velocity_y    = (gr_float *) field.values("velocity_y");
-  gr_float * velocity_z    = (gr_float *) field.values("velocity_z");
-  gr_float * HI_density    = (gr_float *) field.values("HI_density");
-  gr_float * HII_density   = (gr_float *) field.values("HII_density");
-  gr_float * HM_density    = (gr_float *) field.values("HM_density");
-  gr_float * HeI_density   = (gr_float *) field.values("HeI_density");
-  gr_float * HeII_density  = (gr_float *) field.values("HeII_density");
-  gr_float * HeIII_density = (gr_float *) field.values("HeIII_density");
-  gr_float * H2I_density   = (gr_float *) field.values("H2I_density");
-  gr_float * H2II_density  = (gr_float *) field.values("H2II_density");
-  gr_float * DI_density    = (gr_float *) field.values("DI_density");
-  gr_float * DII_density   = (gr_float *) field.values("DII_density");
-  gr_float * HDI_density   = (gr_float *) field.values("HDI_density");
-  gr_float * e_density     = (gr_float *) field.values("e_density");
-  gr_float * metal_density = (gr_float *) field.values("metal_density");
-  gr_float * cooling_time  = (gr_float *) field.values("cooling_time");
-  gr_float * temperature   = (gr_float *) field.values("temperature");
-  gr_float * pressure      = (gr_float *) field.values("pressure");
-  gr_float * gamma         = (gr_float *) field.values("gamma");
-
-  double dt = time_step();
+  gr_float * density       = values[grackle_density];
+  gr_float * energy        = values[grackle_internal_energy];
+  gr_float * velocity_x    = values[grackle_velocity_x];
+  gr_float * velocity_y    = values[grackle_velocity_y];
+  gr_float * velocity_z    = values[grackle_velocity_z];
+  gr_float * HI_density    = values[grackle_HI_density];
+  gr_float * HII_density   = values[grackle_HII_density];
+  gr_float * HM_density    = values[grackle_HM_density];
+  gr_float * HeI_density   = values[grackle_HeI_density];
+  gr_float * HeII_density  = values[grackle_HeII_density];
+  gr_float * HeIII_density = values[grackle_HeIII_density];
+  gr_float * H2I_density   = values[grackle_H2I_density];
+  gr_float * H2II_density  = values[grackle_H2II_density];
+  gr_float * DI_density    = values[grackle_DI_density];
+  gr_float * DII_density   = values[grackle_DII_density];
+  gr_float * HDI_density   = values[grackle_HDI_density];
+  gr_float * e_density     = values[grackle_e_density];
+  gr_float * metal_density = values[grackle_metal_density];
+  gr_float * cooling_time  = values[grackle_cooling_time];
+  gr_float * temperature   = values[grackle_temperature];
+  gr_float * pressure      = values[grackle_pressure];
+  gr_float * gamma         = values[grackle_gamma];
 
   if (solve_chemistry
       (*chemistry_, *units_,
@@ -142,7 +317,7 @@ void EnzoMethodGrackle::compute ( Block * block) throw()
        HDI_density,
        e_density,
        metal_density) == 0) {
-    ERROR("EnzoMethodGrackle::compute()",
+    ERROR("EnzoMethodGrackle::solve_()",
 	  "Error in solve_chemistry");
   }
 
@@ -162,7 +337,7 @@ void EnzoMethodGrackle::compute ( Block * block) throw()
        e_density,
        metal_density,
        cooling_time) == 0) {
-    ERROR("EnzoMethodGrackle::compute()",
+    ERROR("EnzoMethodGrackle::solve_()",
 	  "Error in calculate_cooling_time.\n");
   }
 
@@ -179,7 +354,7 @@ void EnzoMethodGrackle::compute ( Block * block) throw()
        e_density,
        metal_density,
        temperature) == 0) {
-    ERROR("EnzoMethodGrackle::compute()",
+    ERROR("EnzoMethodGrackle::solve_()",
 	  "Error in calculate_temperature.\n");
   }
 
@@ -196,7 +371,7 @@ void EnzoMethodGrackle::compute ( Block * block) throw()
        e_density,
        metal_density,
        pressure) == 0) {
-    ERROR("EnzoMethodGrackle::compute()",
+    ERROR("EnzoMethodGrackle::solve_()",
 	  "Error in calculate_pressure.\n");
   }
 
@@ -213,24 +388,20 @@ void EnzoMethodGrackle::compute ( Block * block) throw()
        e_density,
        metal_density,
        gamma) == 0) {
-    ERROR("EnzoMethodGrackle::compute()",
+    ERROR("EnzoMethodGrackle::solve_()",
 	  "Error in calculate_gamma.\n");
   }
+}
 
 #endif /* CONFIG_USE_GRACKLE */
 
-  EnzoBlock * enzo_block = static_cast<EnzoBlock*> (block);
-
-  enzo_block->compute_done();
-
-}
-
 //----------------------------------------------------------------------
 
 double EnzoMethodGrackle::timestep ( Block * block ) const throw()
 {
 #ifdef CONFIG_USE_GRACKLE
-  initialize_(block);
+  // Grackle sub-cycles each cell internally, so cooling does not
+  // limit dt
   return std::numeric_limits<double>::max();
 #else
   return 0.0;
@@ -12,6 +12,34 @@
 #define ENZO_ENZO_METHOD_GRACKLE_HPP
 
 
+/// @enum     grackle_field_enum
+/// @brief    Index of each field used by Grackle in EnzoMethodGrackle
+enum grackle_field_enum {
+  grackle_density,
+  grackle_internal_energy,
+  grackle_velocity_x,
+  grackle_velocity_y,
+  grackle_velocity_z,
+  grackle_HI_density,
+  grackle_HII_density,
+  grackle_HM_density,
+  grackle_HeI_density,
+  grackle_HeII_density,
+  grackle_HeIII_density,
+  grackle_H2I_density,
+  grackle_H2II_density,
+  grackle_DI_density,
+  grackle_DII_density,
+  grackle_HDI_density,
+  grackle_e_density,
+  grackle_metal_density,
+  grackle_cooling_time,
+  grackle_temperature,
+  grackle_pressure,
+  grackle_gamma,
+  num_grackle_fields
+};
+
 class EnzoMethodGrackle : public Method {
 
   /// @class    EnzoMethodGrackle
@@ -19,6 +47,11 @@ class EnzoMethodGrackle : public Method {
 ///
 /// This class interfaces the Grackle primordial chemistry / cooling
 /// library with Cello
+///
+/// With Method:grackle:batch_size > 0, the active cells of all leaf
+/// Blocks on a process are gathered into contiguous arrays, solved
+/// with Grackle calls of at most batch_size cells, and scattered back
+/// before the Blocks continue.
 
 public: // interface
 
@@ -28,7 +61,8 @@ public: // interface
   void pup (PUP::er &p) ;
 
   /// Create a new EnzoMethodGrackle object
-  EnzoMethodGrackle(EnzoConfig *);
+  EnzoMethodGrackle(const FieldDescr * field_descr,
+		    EnzoConfig * enzo_config);
 
   /// Create a new EnzoMethodGrackle object
   EnzoMethodGrackle() : Method() {};
@@ -46,13 +80,51 @@ public: // interface
   virtual std::string name () throw () 
   { return "grackle"; }
 
-  /// Compute maximum timestep for this method
+  /// Compute maximum timestep for this method: not limited by
+  /// cooling, which Grackle sub-cycles
   virtual double timestep ( Block * block) const throw();
 
+#ifdef CONFIG_USE_GRACKLE
+
+  /// Not with batching, which waits for all Blocks on the process
+  virtual bool allow_subcycle () const throw()
+  { return batch_size_ == 0; }
+
+#endif /* CONFIG_USE_GRACKLE */
+
 protected: // methods
 
+#ifdef CONFIG_USE_GRACKLE
+
+  /// Solve the chemistry for a single Block
+  void compute_block_ (Block * block) throw();
+
+  /// Add the Block to the batch, and solve the batch and continue
+  /// its Blocks once all Blocks on the process have been added
+  void compute_batch_ (Block * block) throw();
+
+  /// Copy the Block's active cells to (gather) or from (scatter) the
+  /// batch arrays starting at offset, returning the number of cells
+  int batch_copy_ (Block * block, int offset, bool gather) throw();
+
+  /// Call Grackle on the arrays indexed by grackle_field_enum, which
+  /// are NULL for undefined fields
+  void solve_ (gr_float ** values,
+	       gr_int rank, gr_int * m,
+	       gr_int * grid_start, gr_int * grid_end,
+	       double dt) throw();
+
+  /// Return the Block's values of the given grackle_field_enum field
+  gr_float * values_ (Field & field, int index) throw()
+  { return field.view<gr_float>(field_[index]).values(); }
+
+#endif /* CONFIG_USE_GRACKLE */
+
 protected: // attributes
 
+  /// Fields accessed by the method, indexed by grackle_field_enum
+  std::vector<FieldHandle> field_;
+
 #ifdef CONFIG_USE_GRACKLE
 
   /// Grackle struct defining code units
@@ -61,6 +133,18 @@ protected: // attributes
   /// Grackle struct defining chemistry data
   chemistry_data * chemistry_;
 
+  /// Maximum number of cells per Grackle call when gathering all leaf
+  /// Blocks on the process into one batch, or 0 to call Grackle once
+  /// per Block
+  int batch_size_;
+
+  /// Blocks added to the current batch [not pup'ed]
+  std::vector<Block *> batch_block_;
+
+  /// Active cells of the leaf Blocks in the current batch, indexed by
+  /// grackle_field_enum and empty for undefined fields [not pup'ed]
+  std::vector< std::vector<gr_float> > batch_values_;
+
 #endif /* ENZO_ENZO_METHOD_GRACKLE_HPP */
 
 };
@@ -121,6 +121,10 @@ public: // interface
   /// Name to call the solver within Enzo-P
   virtual std::string name() throw() { return "gravity_bicgstab"; }
 
+  /// Not with subcycling: BiCGStab dot products reduce over all Blocks
+  virtual bool allow_subcycle () const throw()
+  { return false; }
+
   /// Projects RHS and sets initial vectors R, R0, and P
   template<class T> void start_2(EnzoBlock* enzo_block) throw();
 
@@ -120,7 +120,7 @@ EnzoMethodGravityCg::EnzoMethodGravityCg
 
   const int num_fields = field_descr->field_count();
 
-  field_descr->ghost_depth    (idensity_,&gx_,&gy_,&gz_);
+  field_descr->ghost_depth    (ib_,&gx_,&gy_,&gz_);
 
   const int ir = add_refresh(1,rank-1,neighbor_leaf,sync_barrier);
   //  refresh(ir)->add_field(idensity_);
@@ -144,11 +144,11 @@ void EnzoMethodGravityCg::compute ( Block * block) throw()
   Field field = block->data()->field();
 
   field.size                (&nx_,&ny_,&nz_);
-  field.dimensions(idensity_,&mx_,&my_,&mz_);
+  field.dimensions(ib_,&mx_,&my_,&mz_);
 
   EnzoBlock * enzo_block = static_cast<EnzoBlock*> (block);
 
-  int precision = field.precision(idensity_);
+  int precision = field.precision(ib_);
 
   if      (precision == precision_single)    compute_<float>      (enzo_block);
   else if (precision == precision_double)    compute_<double>     (enzo_block);
@@ -178,30 +178,7 @@ void EnzoMethodGravityCg::compute_ (EnzoBlock * enzo_block) throw()
 
   if (enzo_block->is_leaf()) {
 
-    ///   - X = 0
-    ///   - B = -h^2 * 4 * PI * G * density
-    ///   - R = P = B ( residual with X = 0);
-
-    T * density = (T*) field.values(idensity_);
-    
-    T * B = (T*) field.values(ib_);
-    T * X = (T*) field.values(ix_);
-    T * R = (T*) field.values(ir_);
-
-    const int ix0 = 0;
-    const int iy0 = 0;
-    const int iz0 = 0;
-
-    for (int iz=iz0; iz<mz_-iz0; iz++) {
-      for (int iy=iy0; iy<my_-iy0; iy++) {
-	for (int ix=ix0; ix<mx_-ix0; ix++) {
-	  int i = ix + mx_*(iy + my_*iz);
-	  X[i] = 0.0;
-	  B[i] = - 4.0 * (cello::pi) * grav_const_ * density[i];
-	  R[i] = B[i];
-	}
-      }
-    }
+    cg_initial_(enzo_block);
 
     M_->matvec(id_,ir_,enzo_block);
     M_->matvec(iz_,ir_,enzo_block);
@@ -311,7 +288,7 @@ void EnzoBlock::enzo_matvec_()
     static_cast<EnzoMethodGravityCg*> (this->method());
 
   Field field = data()->field();
-  int precision = field.precision(field.field_id("density")); // assuming 
+  int precision = field.precision(field.field_id("B"));
 
   EnzoBlock * enzo_block = static_cast<EnzoBlock*> (this);
 
@@ -664,24 +641,11 @@ void EnzoMethodGravityCg::cg_end (EnzoBlock * enzo_block,int retval) throw ()
 {
   if (enzo_block->is_leaf()) {
 
-    Data * data = enzo_block->data();
-    Field field = data->field();
-
-    T * X         = (T*) field.values(ix_);
-    T * potential = (T*) field.values(ipotential_);
-
     if (enzo_block->index().is_root()) {
       monitor_output_ (enzo_block);
     }
 
-    copy_(potential,X,mx_,my_,mz_);
-
-    bool symmetric;
-    int order;
-    EnzoComputeAcceleration compute_acceleration (field.field_descr(),
-						  rank_, symmetric = true,
-						  order=2);
-    compute_acceleration.compute(enzo_block);
+    cg_solution_(enzo_block);
 
   }
 
@@ -690,6 +654,96 @@ void EnzoMethodGravityCg::cg_end (EnzoBlock * enzo_block,int retval) throw ()
 
 //----------------------------------------------------------------------
 
+void EnzoMethodGravityCg::cg_initial_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int precision = field.precision(ib_);
+
+  if      (precision == precision_single)    
+    gravity_initial_<float>      (enzo_block);
+  else if (precision == precision_double)    
+    gravity_initial_<double>     (enzo_block);
+  else if (precision == precision_quadruple) 
+    gravity_initial_<long double>(enzo_block);
+  else 
+    ERROR1("EnzoMethodGravityCg()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoMethodGravityCg::gravity_initial_ (EnzoBlock * enzo_block) throw()
+///   - X = 0
+///   - B = -h^2 * 4 * PI * G * density
+///   - R = P = B ( residual with X = 0);
+{
+  Field field = enzo_block->data()->field();
+
+  T * density = (T*) field.values(idensity_);
+    
+  T * B = (T*) field.values(ib_);
+  T * X = (T*) field.values(ix_);
+  T * R = (T*) field.values(ir_);
+
+  const int ix0 = 0;
+  const int iy0 = 0;
+  const int iz0 = 0;
+
+  for (int iz=iz0; iz<mz_-iz0; iz++) {
+    for (int iy=iy0; iy<my_-iy0; iy++) {
+      for (int ix=ix0; ix<mx_-ix0; ix++) {
+	int i = ix + mx_*(iy + my_*iz);
+	X[i] = 0.0;
+	B[i] = - 4.0 * (cello::pi) * grav_const_ * density[i];
+	R[i] = B[i];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodGravityCg::cg_solution_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int precision = field.precision(ib_);
+
+  if      (precision == precision_single)    
+    gravity_solution_<float>      (enzo_block);
+  else if (precision == precision_double)    
+    gravity_solution_<double>     (enzo_block);
+  else if (precision == precision_quadruple) 
+    gravity_solution_<long double>(enzo_block);
+  else 
+    ERROR1("EnzoMethodGravityCg()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoMethodGravityCg::gravity_solution_ (EnzoBlock * enzo_block) throw()
+///   - potential = X
+///   - compute acceleration from potential
+{
+  Field field = enzo_block->data()->field();
+
+  T * X         = (T*) field.values(ix_);
+  T * potential = (T*) field.values(ipotential_);
+
+  copy_(potential,X,mx_,my_,mz_);
+
+  bool symmetric;
+  int order;
+  EnzoComputeAcceleration compute_acceleration (field.field_descr(),
+						rank_, symmetric = true,
+						order=2);
+  compute_acceleration.compute(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodGravityCg::monitor_output_(EnzoBlock * enzo_block) throw()
 {
 
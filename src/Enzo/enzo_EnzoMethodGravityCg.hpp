@@ -101,6 +101,10 @@ public: // interface
   virtual std::string name () throw () 
   { return "gravity_cg"; }
 
+  /// Not with subcycling: CG dot products reduce over all Blocks
+  virtual bool allow_subcycle () const throw()
+  { return false; }
+
   /// Continuation after global reduction
   template <class T>
   void cg_shift_1(EnzoBlock * enzo_block) throw();
@@ -151,6 +155,20 @@ public: // interface
 
 protected: // methods
 
+  /// Initialize X, B, and R = B - A*X on a leaf Block: by default
+  /// X = 0 and B = -4 pi G density
+  virtual void cg_initial_ (EnzoBlock * enzo_block) throw();
+
+  /// Use the converged solution X on a leaf Block: by default copy
+  /// X to the potential and compute the acceleration
+  virtual void cg_solution_ (EnzoBlock * enzo_block) throw();
+
+  template <class T>
+  void gravity_initial_ (EnzoBlock * enzo_block) throw();
+
+  template <class T>
+  void gravity_solution_ (EnzoBlock * enzo_block) throw();
+
   void monitor_output_(EnzoBlock * enzo_block) throw();
 
   template <class T>
@@ -445,14 +445,18 @@ void EnzoMethodGravityMlat::send_faces_(EnzoBlock * enzo_block) throw()
     int if3[3];
 
     // for each neighbor
-    ItNeighbor it_neighbor = enzo_block->it_neighbor(min_face_rank,index);
+    const std::vector<Neighbor> & neighbor_list = enzo_block->neighbor_list();
 
-    while (it_neighbor.next()) {
-      Index index_neighbor = it_neighbor.index();
+    for (size_t i=0; i<neighbor_list.size(); i++) {
+      const Neighbor & neighbor = neighbor_list[i];
+      if (neighbor.face_rank < min_face_rank) continue;
+      Index index_neighbor = neighbor.index;
       int level_neighbor = index_neighbor.level();
 
-      it_neighbor.child(ic3);
-      it_neighbor.face (if3);
+      for (int axis=0; axis<3; axis++) {
+	ic3[axis] = neighbor.child[axis];
+	if3[axis] = neighbor.face[axis];
+      }
       int of3[3] = {if3[0],if3[1],if3[2]};
       int type_op_array = op_array_unknown;
 
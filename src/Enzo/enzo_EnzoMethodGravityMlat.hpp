@@ -92,6 +92,10 @@ public: // interface
   virtual std::string name () throw () 
   { return "gravity_mg"; }
 
+  /// Not with subcycling: the V-cycle synchronizes all Blocks
+  virtual bool allow_subcycle () const throw()
+  { return false; }
+
   void compute_correction(EnzoBlock * enzo_block) throw();
 
 protected: // methods
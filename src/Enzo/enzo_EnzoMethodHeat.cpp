@@ -11,11 +11,18 @@
 
 //----------------------------------------------------------------------
 
-EnzoMethodHeat::EnzoMethodHeat (const FieldDescr * field_descr, double alpha, double courant) 
+EnzoMethodHeat::EnzoMethodHeat (const FieldDescr * field_descr, double alpha, double courant,
+				int substeps) 
   : Method(),
     alpha_(alpha),
-    courant_(courant)
+    courant_(courant),
+    substeps_(substeps),
+    buffer_()
 {
+  ASSERT1 ("EnzoMethodHeat::EnzoMethodHeat()",
+	   "Method:heat:substeps = %d must be at least 1",
+	   substeps_, substeps_ >= 1);
+
   // Initialize default Refresh object
 
   const int ir = add_refresh(4,0,neighbor_leaf,sync_barrier);
@@ -36,6 +43,7 @@ void EnzoMethodHeat::pup (PUP::er &p)
 
   p | alpha_;
   p | courant_;
+  p | substeps_;
 }
 
 //----------------------------------------------------------------------
@@ -91,13 +99,15 @@ double EnzoMethodHeat::timestep ( Block * block ) const throw()
   if (rank >= 2) h_min = std::min(h_min,hy);
   if (rank >= 3) h_min = std::min(h_min,hz);
 
-  return 0.5*courant_*h_min*h_min/alpha_;
+  // The timestep is divided into substeps_ stable steps
+
+  return substeps_*0.5*courant_*h_min*h_min/alpha_;
 }
 
 //======================================================================
 
 template <class T>
-void EnzoMethodHeat::compute_ (Block * block,T * Unew) const throw()
+void EnzoMethodHeat::compute_ (Block * block,T * U) throw()
 {
   Data * data = block->data();
   Field field   =      data->field();
@@ -137,57 +147,93 @@ void EnzoMethodHeat::compute_ (Block * block,T * Unew) const throw()
 
   const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
 
-  const double dt = timestep(block);
+  const int g_min = std::min
+    (gx, std::min ((rank >= 2) ? gy : gx, (rank >= 3) ? gz : gx));
 
-  T * U = new T [m];
-  for (int i=0; i<m; i++) U[i]=Unew[i];
+  ASSERT2 ("EnzoMethodHeat::compute_()",
+	   "Field ghost depth %d must be at least Method:heat:substeps = %d",
+	   g_min, substeps_, g_min >= substeps_);
 
-  if (rank == 1) {
+  const double dt = block->dt() / substeps_;
 
-    for (int ix=gx; ix<nx+gx; ix++) {
+  // Alternate between the field and the buffer, which is only
+  // reallocated if a larger block is encountered
 
-      int i = ix;
+  if (buffer_.size() < m*sizeof(T)) buffer_.resize(m*sizeof(T));
 
-      double Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
+  T * U_old = U;
+  T * U_new = (T *) &buffer_[0];
 
-      Unew[i] = U[i] + alpha_*dt*(Uxx);
+  for (int step=0; step<substeps_; step++) {
 
-    }
+    // Depth of ghost zones still needed by later substeps
+
+    const int g = substeps_ - step - 1;
+
+    const int ex = g;
+    const int ey = (rank >= 2) ? g : 0;
+    const int ez = (rank >= 3) ? g : 0;
+
+    if (rank == 1) {
+
+      for (int ix=gx-ex; ix<nx+gx+ex; ix++) {
 
-  } else if (rank == 2) {
+	int i = ix;
 
-    for (int iy=gy; iy<ny+gy; iy++) {
-      for (int ix=gy; ix<nx+gy; ix++) {
+	double Uxx = dxi*(U_old[i-idx] - 2*U_old[i] + U_old[i+idx]);
 
-	int i = ix + mx*iy;
+	U_new[i] = U_old[i] + alpha_*dt*(Uxx);
 
-	double Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
-	double Uyy = dyi*(U[i-idy] - 2*U[i] + U[i+idy]);
+      }
+
+    } else if (rank == 2) {
+
+      for (int iy=gy-ey; iy<ny+gy+ey; iy++) {
+	for (int ix=gx-ex; ix<nx+gx+ex; ix++) {
+
+	  int i = ix + mx*iy;
+
+	  double Uxx = dxi*(U_old[i-idx] - 2*U_old[i] + U_old[i+idx]);
+	  double Uyy = dyi*(U_old[i-idy] - 2*U_old[i] + U_old[i+idy]);
 	
-	Unew[i] = U[i] + alpha_*dt*(Uxx + Uyy);
+	  U_new[i] = U_old[i] + alpha_*dt*(Uxx + Uyy);
 
+	}
       }
-    }
 
-  } else if (rank == 3) {
+    } else if (rank == 3) {
 
-    for (int iz=gz; iz<nz+gz; iz++) {
-      for (int iy=gy; iy<ny+gy; iy++) {
-	for (int ix=gx; ix<nx+gx; ix++) {
+      for (int iz=gz-ez; iz<nz+gz+ez; iz++) {
+	for (int iy=gy-ey; iy<ny+gy+ey; iy++) {
+	  for (int ix=gx-ex; ix<nx+gx+ex; ix++) {
 
-	  int i = ix + mx*(iy + my*iz);
+	    int i = ix + mx*(iy + my*iz);
 
-	  double Uxx = dxi*(U[i-idx] - 2*U[i] + U[i+idx]);
-	  double Uyy = dyi*(U[i-idy] - 2*U[i] + U[i+idy]);
-	  double Uzz = dzi*(U[i-idz] - 2*U[i] + U[i+idz]);
+	    double Uxx = dxi*(U_old[i-idx] - 2*U_old[i] + U_old[i+idx]);
+	    double Uyy = dyi*(U_old[i-idy] - 2*U_old[i] + U_old[i+idy]);
+	    double Uzz = dzi*(U_old[i-idz] - 2*U_old[i] + U_old[i+idz]);
 
-	  Unew[i] = U[i] + alpha_*dt*(Uxx + Uyy + Uzz);
+	    U_new[i] = U_old[i] + alpha_*dt*(Uxx + Uyy + Uzz);
 
+	  }
 	}
       }
     }
+
+    std::swap (U_old,U_new);
   }
 
-  delete [] U;
+  // Copy the interior back to the field after an odd number of substeps
+
+  if (U_old != U) {
+    for (int iz=gz; iz<nz+gz; iz++) {
+      for (int iy=gy; iy<ny+gy; iy++) {
+	for (int ix=gx; ix<nx+gx; ix++) {
+	  int i = ix + mx*(iy + my*iz);
+	  U[i] = U_old[i];
+	}
+      }
+    }
+  }
 
 }
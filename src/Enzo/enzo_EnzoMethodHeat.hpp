@@ -16,11 +16,19 @@ class EnzoMethodHeat : public Method {
   ///
   /// @brief [\ref Enzo] Demonstration method to solve heat equation
   /// using forward Euler method
+  ///
+  /// With substeps k > 1, each refresh is followed by k forward Euler
+  /// steps of dt/k, the j'th updating the ghost zones to depth k-j-1
+  /// as well as the interior, so Field:ghost_depth must be at least
+  /// k.  Ghost zones at the domain boundary are advanced with the
+  /// same stencil during the substeps rather than reset by the
+  /// boundary conditions.
 
 public: // interface
 
   /// Create a new EnzoMethodHeat object
-  EnzoMethodHeat(const FieldDescr *, double alpha, double courant);
+  EnzoMethodHeat(const FieldDescr *, double alpha, double courant,
+		 int substeps);
 
   EnzoMethodHeat() {};
 
@@ -45,7 +53,7 @@ public: // interface
 protected: // methods
 
   template <class T>
-  void compute_ (Block * block, T * Unew ) const throw();
+  void compute_ (Block * block, T * U ) throw();
 
 protected: // attributes
 
@@ -54,6 +62,13 @@ protected: // attributes
 
   /// Courant safety number
   double courant_;
+
+  /// Number of forward Euler steps per refresh
+  int substeps_;
+
+  /// Buffer alternating with the temperature field between substeps
+  /// [not pup'ed]
+  std::vector<char> buffer_;
 };
 
 #endif /* ENZO_ENZO_METHOD_HEAT_HPP */
@@ -0,0 +1,174 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodHeatImplicit.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implements the EnzoMethodHeatImplicit class
+///
+/// Theta-method solver for the heat equation dT/dt = alpha * L T
+///
+///     - A = I - theta*dt*alpha*L           (EnzoMatrixDiffusion)
+///     - B = T + (1-theta)*dt*alpha*L T
+///     - X = T                              initial guess
+///     - solve A*X = B                      (EnzoMethodGravityCg)
+///     - T = X                              interior only
+///
+/// The CG search directions get their ghost zones from the Boundary of
+/// their own fields, so periodic boundaries are required for A to be
+/// the same operator in the residual and in the CG iterations.
+
+#include "cello.hpp"
+
+#include "enzo.hpp"
+
+//----------------------------------------------------------------------
+
+EnzoMethodHeatImplicit::EnzoMethodHeatImplicit
+(const FieldDescr * field_descr, int rank,
+ double alpha, double theta, double dt,
+ int iter_max, double res_tol, int monitor_iter) 
+  : EnzoMethodGravityCg(field_descr, rank, 0.0,
+			iter_max, res_tol, monitor_iter,
+			false, false),
+    itemperature_(field_descr->field_id("temperature")),
+    alpha_(alpha),
+    theta_(theta),
+    dt_(dt)
+{
+  ASSERT1 ("EnzoMethodHeatImplicit()",
+	   "theta = %g must be between 0.5 and 1 for stability",
+	   theta, (0.5 <= theta && theta <= 1.0));
+
+  delete A_;
+  A_ = new EnzoMatrixDiffusion;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeatImplicit::compute ( Block * block) throw()
+{
+  // All Blocks share the same dt since subcycling is not allowed
+
+  static_cast<EnzoMatrixDiffusion*>(A_)->set_coefficient
+    (theta_*block->dt()*alpha_);
+
+  EnzoMethodGravityCg::compute(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeatImplicit::cg_initial_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int precision = field.precision(itemperature_);
+
+  if      (precision == precision_single)    
+    heat_initial_<float>      (enzo_block);
+  else if (precision == precision_double)    
+    heat_initial_<double>     (enzo_block);
+  else if (precision == precision_quadruple) 
+    heat_initial_<long double>(enzo_block);
+  else 
+    ERROR1("EnzoMethodHeatImplicit()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoMethodHeatImplicit::heat_initial_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  T * temperature = (T*) field.values(itemperature_);
+
+  T * B = (T*) field.values(ib_);
+  T * X = (T*) field.values(ix_);
+  T * R = (T*) field.values(ir_);
+  T * Y = (T*) field.values(iy_);
+
+  const int m = mx_*my_*mz_;
+
+  for (int i=0; i<m; i++) {
+    X[i] = temperature[i];
+    B[i] = temperature[i];
+    R[i] = 0.0;
+  }
+
+  const int i0 = gx_ + mx_*(gy_ + my_*gz_);
+
+  // Explicit part of Crank-Nicolson: Y = L T
+
+  if (theta_ < 1.0) {
+
+    EnzoMatrixLaplace laplace;
+    laplace.matvec(iy_,ix_,enzo_block);
+
+    const T c = (1.0 - theta_) * enzo_block->dt() * alpha_;
+
+    for (int iz=0; iz<nz_; iz++) {
+      for (int iy=0; iy<ny_; iy++) {
+	for (int ix=0; ix<nx_; ix++) {
+	  int i = i0 + (ix + mx_*(iy + my_*iz));
+	  B[i] += c * Y[i];
+	}
+      }
+    }
+  }
+
+  // Residual of the initial guess: R = B - A*X
+
+  A_->matvec(iy_,ix_,enzo_block);
+
+  for (int iz=0; iz<nz_; iz++) {
+    for (int iy=0; iy<ny_; iy++) {
+      for (int ix=0; ix<nx_; ix++) {
+	int i = i0 + (ix + mx_*(iy + my_*iz));
+	R[i] = B[i] - Y[i];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeatImplicit::cg_solution_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  int precision = field.precision(itemperature_);
+
+  if      (precision == precision_single)    
+    heat_solution_<float>      (enzo_block);
+  else if (precision == precision_double)    
+    heat_solution_<double>     (enzo_block);
+  else if (precision == precision_quadruple) 
+    heat_solution_<long double>(enzo_block);
+  else 
+    ERROR1("EnzoMethodHeatImplicit()", "precision %d not recognized", precision);
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoMethodHeatImplicit::heat_solution_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  T * temperature = (T*) field.values(itemperature_);
+  T * X           = (T*) field.values(ix_);
+
+  // Ghost zones of X are never updated by the solver, so copy only
+  // the interior and leave the temperature ghost zones to refresh
+
+  const int i0 = gx_ + mx_*(gy_ + my_*gz_);
+
+  for (int iz=0; iz<nz_; iz++) {
+    for (int iy=0; iy<ny_; iy++) {
+      for (int ix=0; ix<nx_; ix++) {
+	int i = i0 + (ix + mx_*(iy + my_*iz));
+	temperature[i] = X[i];
+      }
+    }
+  }
+}
@@ -0,0 +1,102 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodHeatImplicit.hpp
+/// @author   James Bordner (jobordner@ucsd.edu) 
+/// @date     2026-10-19
+/// @brief    [\ref Enzo] Declaration of EnzoMethodHeatImplicit
+///           implicit solver for the heat equation
+
+#ifndef ENZO_ENZO_METHOD_HEAT_IMPLICIT_HPP
+#define ENZO_ENZO_METHOD_HEAT_IMPLICIT_HPP
+
+class EnzoMethodHeatImplicit : public EnzoMethodGravityCg {
+
+  /// @class    EnzoMethodHeatImplicit
+  /// @ingroup  Enzo
+  ///
+  /// @brief [\ref Enzo] Solve the heat equation with the theta method,
+  /// using the conjugate gradient solver of EnzoMethodGravityCg
+  ///
+  /// Each timestep solves (I - theta*dt*alpha*L) T' = (I +
+  /// (1-theta)*dt*alpha*L) T for the new temperature T', where L is
+  /// the discrete Laplacian: theta = 1 is backward Euler and theta =
+  /// 0.5 is Crank-Nicolson.  Both are unconditionally stable, so the
+  /// timestep is not limited by the method unless Method:heat_implicit:dt
+  /// is set.  Requires the CG fields B, D, R, X, Y and Z, and periodic
+  /// boundary conditions.
+
+public: // interface
+
+  /// Create a new EnzoMethodHeatImplicit object
+  EnzoMethodHeatImplicit(const FieldDescr * field_descr, int rank,
+			 double alpha,
+			 double theta,
+			 double dt,
+			 int iter_max, 
+			 double res_tol,
+			 int monitor_iter);
+
+  EnzoMethodHeatImplicit() {};
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoMethodHeatImplicit);
+  
+  /// Charm++ PUP::able migration constructor
+  EnzoMethodHeatImplicit (CkMigrateMessage *m) {}
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+
+    // NOTE: change this function whenever attributes change
+
+    TRACEPUP;
+
+    EnzoMethodGravityCg::pup(p);
+
+    p | itemperature_;
+    p | alpha_;
+    p | theta_;
+    p | dt_;
+  }
+
+  /// Apply the method to advance a block one timestep 
+  virtual void compute( Block * block) throw();
+
+  virtual std::string name () throw () 
+  { return "heat_implicit"; }
+
+  /// Return the optional fixed timestep; otherwise unlimited
+  virtual double timestep ( Block * block) const throw()
+  { return dt_; }
+
+protected: // methods
+
+  /// X = T, B = (I + (1-theta)*dt*alpha*L) T, and R = B - A*X
+  virtual void cg_initial_ (EnzoBlock * enzo_block) throw();
+
+  /// T = X in the interior
+  virtual void cg_solution_ (EnzoBlock * enzo_block) throw();
+
+  template <class T>
+  void heat_initial_ (EnzoBlock * enzo_block) throw();
+
+  template <class T>
+  void heat_solution_ (EnzoBlock * enzo_block) throw();
+
+protected: // attributes
+
+  /// Temperature field id
+  int itemperature_;
+
+  /// Thermal diffusivity
+  double alpha_;
+
+  /// Implicitness: 1 for backward Euler, 0.5 for Crank-Nicolson
+  double theta_;
+
+  /// Fixed timestep, or maximum double if unlimited
+  double dt_;
+};
+
+#endif /* ENZO_ENZO_METHOD_HEAT_IMPLICIT_HPP */
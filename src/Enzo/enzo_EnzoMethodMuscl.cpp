@@ -0,0 +1,608 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodMuscl.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-19
+/// @brief    Implements the EnzoMethodMuscl class
+
+#include "cello.hpp"
+
+#include "enzo.hpp"
+
+//----------------------------------------------------------------------
+
+EnzoMethodMuscl::EnzoMethodMuscl
+(
+ const FieldDescr * field_descr,
+ EnzoConfig * enzo_config
+)
+  : Method(),
+    gamma_(enzo_config->field_gamma),
+    courant_(enzo_config->field_courant),
+    ghost_depth_(enzo_config->method_muscl_ghost_depth),
+    density_(field_descr,"density"),
+    total_energy_(field_descr,"total_energy"),
+    colour_()
+{
+  velocity_[0]     = FieldHandle(field_descr,"velocity_x");
+  velocity_[1]     = FieldHandle(field_descr,"velocity_y");
+  velocity_[2]     = FieldHandle(field_descr,"velocity_z");
+  acceleration_[0] = FieldHandle(field_descr,"acceleration_x");
+  acceleration_[1] = FieldHandle(field_descr,"acceleration_y");
+  acceleration_[2] = FieldHandle(field_descr,"acceleration_z");
+
+  for (int index_field = 0;
+       index_field < field_descr->field_count();
+       index_field++) {
+    std::string name = field_descr->field_name(index_field);
+    if (field_descr->groups()->is_in(name,"colour")) {
+      colour_.push_back(FieldHandle(field_descr,name));
+    }
+  }
+
+  ASSERT1 ("EnzoMethodMuscl::EnzoMethodMuscl()",
+	   "Method:muscl:ghost_depth %d must be at least 2",
+	   ghost_depth_,
+	   ghost_depth_ >= 2);
+
+  // The refresh cannot fill more ghost zones than the fields have
+
+  int g3[3];
+  field_descr->ghost_depth (density_.id(),&g3[0],&g3[1],&g3[2]);
+  for (int axis = 0; axis < enzo_config->mesh_root_rank; axis++) {
+    ASSERT3 ("EnzoMethodMuscl::EnzoMethodMuscl()",
+	     "Method:muscl:ghost_depth %d exceeds Field:ghost_depth %d "
+	     "along axis %d",
+	     ghost_depth_,g3[axis],axis,
+	     ghost_depth_ <= g3[axis]);
+  }
+
+  ASSERT ("EnzoMethodMuscl::EnzoMethodMuscl()",
+	  "Comoving coordinates are not supported by the muscl method",
+	  ! enzo_config->physics_cosmology);
+
+  // Initialize default Refresh object
+
+  const int ir = add_refresh(ghost_depth_,0,neighbor_leaf,sync_barrier);
+  refresh(ir)->add_all_fields(field_descr->field_count());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodMuscl::pup (PUP::er &p)
+{
+  // NOTE: change this function whenever attributes change
+
+  TRACEPUP;
+
+  Method::pup(p);
+
+  p | gamma_;
+  p | courant_;
+  p | ghost_depth_;
+  p | density_;
+  p | total_energy_;
+  PUParray(p,velocity_,3);
+  PUParray(p,acceleration_,3);
+  p | colour_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodMuscl::compute ( Block * block) throw()
+{
+  if (block->is_leaf()) {
+
+    Field field = block->data()->field();
+
+    const int p = field.precision (density_.id());
+
+    if      (p == precision_single)    compute_<float>(block);
+    else if (p == precision_double)    compute_<double>(block);
+    else if (p == precision_quadruple) compute_<long double>(block);
+    else
+      ERROR1("EnzoMethodMuscl()", "precision %d not recognized", p);
+  }
+
+  block->compute_done();
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodMuscl::timestep ( Block * block ) const throw()
+{
+  Field field = block->data()->field();
+
+  const int p = field.precision (density_.id());
+
+  if      (p == precision_single)    return timestep_<float>(block);
+  else if (p == precision_double)    return timestep_<double>(block);
+  else if (p == precision_quadruple) return timestep_<long double>(block);
+  else
+    ERROR1("EnzoMethodMuscl()", "precision %d not recognized", p);
+
+  return 0.0;
+}
+
+//======================================================================
+
+template <class T>
+void EnzoMethodMuscl::compute_ (Block * block) throw()
+{
+  Data * data = block->data();
+  Field field = data->field();
+
+  const int rank = block->rank();
+
+  FieldView<T> density = field.view<T>(density_);
+
+  T * d  = density.values();
+  T * te = field.view<T>(total_energy_).values();
+  T * v3[3] =
+    { field.view<T>(velocity_[0]).values(),
+      (rank >= 2) ? field.view<T>(velocity_[1]).values() : NULL,
+      (rank >= 3) ? field.view<T>(velocity_[2]).values() : NULL };
+
+  // gravity is included if acceleration fields are defined; views of
+  // undefined fields are NULL
+
+  T * a3[3] = { NULL, NULL, NULL };
+  for (int axis = 0; axis < rank; axis++) {
+    a3[axis] = field.view<T>(acceleration_[axis]).values();
+  }
+
+  // colour fields are advected as mass fractions
+
+  std::vector<T *> colour (colour_.size());
+  for (size_t ic = 0; ic < colour_.size(); ic++) {
+    colour[ic] = field.view<T>(colour_[ic]).values();
+  }
+
+  int m3[3];
+  density.dimensions (&m3[0],&m3[1],&m3[2]);
+  int g3[3];
+  density.ghost_depth (&g3[0],&g3[1],&g3[2]);
+
+  for (int axis = 0; axis < rank; axis++) {
+    ASSERT2 ("EnzoMethodMuscl::compute_()",
+	     "ghost depth %d along axis %d must be at least 2",
+	     g3[axis],axis,
+	     g3[axis] >= 2);
+  }
+
+  double xm,ym,zm;
+  data->lower(&xm,&ym,&zm);
+  double xp,yp,zp;
+  data->upper(&xp,&yp,&zp);
+  double h3[3];
+  field.cell_width(xm,xp,&h3[0],
+		   ym,yp,&h3[1],
+		   zm,zp,&h3[2]);
+
+  const T dt    = block->dt();
+  const T gamma = gamma_;
+  const T gm1   = gamma - 1;
+  const T dmin  = tiny;
+  const T pmin  = tiny;
+
+  // primitive quantities: density, velocity x,y,z, pressure, then
+  // colour mass fractions
+
+  const int nc = colour.size();
+  const int nq = 5 + nc;
+
+  const int mx = m3[0];
+  const int my = m3[1];
+  const int s3[3] = { 1, mx, mx*my };
+
+  // The Block is swept one slab at a time along the outer axis (z in
+  // 3D, y in 2D, x in 1D).  A slab's cells have the same indices
+  // within the slab as within the Block, and only the last few slabs
+  // of each scratch array are kept
+
+  const int ao = rank - 1;
+  const int ms = s3[ao];
+  const int ns = nq*ms;
+
+  const size_t scratch_size = ((7 + 2*rank)*ns + 3*nq)*sizeof(T);
+  if (scratch_.size() < scratch_size) scratch_.resize(scratch_size);
+
+  T * w_ring  = (T *) &scratch_[0];       // primitives: 3 slabs
+  T * dw_ring = w_ring  + 3*ns;           // slopes: 2 slabs of rank
+  T * wh_ring = dw_ring + 2*rank*ns;      // half-step states: 2 slabs
+  T * du_ring = wh_ring + 2*ns;           // conserved updates: 2 slabs
+  T * wl      = du_ring + 2*ns;           // face states and flux
+  T * wr      = wl + nq;
+  T * f       = wr + nq;
+
+  // cells with at least one neighbor on each side, and active cells
+
+  int lo3[3] = {0,0,0}, hi3[3] = {0,0,0};
+  int la3[3] = {0,0,0}, ha3[3] = {0,0,0};
+  for (int axis = 0; axis < rank; axis++) {
+    lo3[axis] = 1;
+    hi3[axis] = m3[axis] - 2;
+    la3[axis] = g3[axis];
+    ha3[axis] = m3[axis] - g3[axis] - 1;
+  }
+
+  // Slab k is predicted once primitives of slabs k-1..k+1 are known.
+  // Its inner faces, and the outer face shared with slab k-1, are
+  // then solved, after which slab k-1 is complete and updated
+
+  for (int k = la3[ao] - 1; k <= ha3[ao] + 1; k++) {
+
+    //--------------------------------------------------
+    // Primitive variables of slabs up to k+1
+    //--------------------------------------------------
+
+    for (int kw = (k == la3[ao] - 1) ? k - 1 : k + 1; kw <= k + 1; kw++) {
+      T * w = w_ring + (kw%3)*ns;
+      for (int ic = 0; ic < ms; ic++) {
+	const int i = ic + ms*kw;
+	const T di = MAX(d[i], dmin);
+	const T vx = v3[0][i];
+	const T vy = v3[1] ? v3[1][i] : T(0);
+	const T vz = v3[2] ? v3[2][i] : T(0);
+	w[0*ms+ic] = di;
+	w[1*ms+ic] = vx;
+	w[2*ms+ic] = vy;
+	w[3*ms+ic] = vz;
+	w[4*ms+ic] = MAX(pmin, gm1*di*(te[i] - T(0.5)*(vx*vx + vy*vy + vz*vz)));
+      }
+      for (int icol = 0; icol < nc; icol++) {
+	for (int ic = 0; ic < ms; ic++) {
+	  w[(5+icol)*ms+ic] = colour[icol][ic + ms*kw] / w[ic];
+	}
+      }
+    }
+
+    const T * wm = w_ring + ((k+2)%3)*ns;
+    const T * w  = w_ring + (k%3)*ns;
+    const T * wp = w_ring + ((k+1)%3)*ns;
+    T * dw = dw_ring + (k%2)*rank*ns;
+    T * wh = wh_ring + (k%2)*ns;
+
+    // cells of slab k with neighbors on each side
+
+    int lk3[3] = { lo3[0], lo3[1], lo3[2] };
+    int hk3[3] = { hi3[0], hi3[1], hi3[2] };
+    lk3[ao] = hk3[ao] = k;
+
+    //--------------------------------------------------
+    // Monotonized central slopes
+    //--------------------------------------------------
+
+    for (int axis = 0; axis < rank; axis++) {
+      const int s = s3[axis];
+      for (int q = 0; q < nq; q++) {
+	// neighbors are in adjacent slabs along the outer axis
+	const T * wq  = &w[q*ms];
+	const T * wqm = (axis == ao) ? &wm[q*ms] : wq;
+	const T * wqp = (axis == ao) ? &wp[q*ms] : wq;
+	const int sm  = (axis == ao) ? 0 : s;
+	T * sq = &dw[axis*ns + q*ms];
+	for (int iz = lk3[2]; iz <= hk3[2]; iz++) {
+	  for (int iy = lk3[1]; iy <= hk3[1]; iy++) {
+	    for (int ix = lk3[0]; ix <= hk3[0]; ix++) {
+	      const int ic = ix + mx*(iy + my*iz) - ms*k;
+	      const T dl = wq[ic]     - wqm[ic-sm];
+	      const T dr = wqp[ic+sm] - wq[ic];
+	      const T dc = T(0.5)*(dl + dr);
+	      const T dlim = MIN(T(fabs(dc)), T(2)*MIN(T(fabs(dl)),T(fabs(dr))));
+	      sq[ic] = (dl*dr > 0) ? ((dc >= 0) ? dlim : -dlim) : T(0);
+	    }
+	  }
+	}
+      }
+    }
+
+    //--------------------------------------------------
+    // Hancock half-step predictor in primitive variables
+    //--------------------------------------------------
+
+    for (int iz = lk3[2]; iz <= hk3[2]; iz++) {
+      for (int iy = lk3[1]; iy <= hk3[1]; iy++) {
+	for (int ix = lk3[0]; ix <= hk3[0]; ix++) {
+	  const int ic = ix + mx*(iy + my*iz) - ms*k;
+	  const T di = w[0*ms+ic];
+	  const T pi = w[4*ms+ic];
+	  T dd = 0, dp = 0;
+	  T dv[3] = { 0, 0, 0 };
+	  for (int axis = 0; axis < rank; axis++) {
+	    const T * sa = &dw[axis*ns];
+	    const T hi = T(1.0/h3[axis]);
+	    const T ua = w[(1+axis)*ms+ic];
+	    const T sd = sa[0*ms+ic]*hi;
+	    const T su = sa[(1+axis)*ms+ic]*hi;
+	    const T sp = sa[4*ms+ic]*hi;
+	    dd += ua*sd + di*su;
+	    dp += ua*sp + gamma*pi*su;
+	    for (int iv = 0; iv < 3; iv++) dv[iv] += ua*sa[(1+iv)*ms+ic]*hi;
+	    dv[axis] += sp/di;
+	  }
+	  wh[0*ms+ic] = MAX(dmin, di - T(0.5)*dt*dd);
+	  for (int iv = 0; iv < 3; iv++)
+	    wh[(1+iv)*ms+ic] = w[(1+iv)*ms+ic] - T(0.5)*dt*dv[iv];
+	  wh[4*ms+ic] = MAX(pmin, pi - T(0.5)*dt*dp);
+	  for (int q = 5; q < nq; q++) {
+	    T dx = 0;
+	    for (int axis = 0; axis < rank; axis++) {
+	      dx += w[(1+axis)*ms+ic]*dw[axis*ns + q*ms+ic]/T(h3[axis]);
+	    }
+	    wh[q*ms+ic] = w[q*ms+ic] - T(0.5)*dt*dx;
+	  }
+	}
+      }
+    }
+
+    //--------------------------------------------------
+    // HLLC fluxes through inner faces of active slab k
+    //--------------------------------------------------
+
+    T * du = du_ring + (k%2)*ns;
+
+    const bool active   = (k <= ha3[ao]);
+    const bool previous = (k - 1 >= la3[ao]);
+
+    if (active) {
+
+      for (int i = 0; i < ns; i++) du[i] = T(0);
+
+      for (int axis = 0; axis < ao; axis++) {
+
+	const int s = s3[axis];
+	const T dtdh = T(dt/h3[axis]);
+
+	// faces between cells ic and ic+s, with ic starting one ghost
+	// zone below the active region along axis
+
+	int f_lo3[3] = { la3[0], la3[1], la3[2] };
+	int f_hi3[3] = { ha3[0], ha3[1], ha3[2] };
+	f_lo3[axis] = la3[axis] - 1;
+	f_lo3[ao] = f_hi3[ao] = k;
+
+	for (int iz = f_lo3[2]; iz <= f_hi3[2]; iz++) {
+	  for (int iy = f_lo3[1]; iy <= f_hi3[1]; iy++) {
+	    for (int ix = f_lo3[0]; ix <= f_hi3[0]; ix++) {
+	      const int ic = ix + mx*(iy + my*iz) - ms*k;
+	      flux_<T> (axis, nq, ms,
+			wh + ic,     dw + axis*ns + ic,
+			wh + ic + s, dw + axis*ns + ic + s,
+			wl, wr, f);
+	      for (int q = 0; q < nq; q++) {
+		du[q*ms+ic]   -= dtdh*f[q];
+		du[q*ms+ic+s] += dtdh*f[q];
+	      }
+	    }
+	  }
+	}
+      }
+    }
+
+    //--------------------------------------------------
+    // HLLC fluxes through outer faces between slabs k-1 and k
+    //--------------------------------------------------
+
+    if (k == la3[ao] - 1) continue;
+
+    const T * whm = wh_ring + ((k+1)%2)*ns;
+    const T * dwm = dw_ring + ((k+1)%2)*rank*ns + ao*ns;
+    T * dum = du_ring + ((k+1)%2)*ns;
+
+    {
+      const T dtdh = T(dt/h3[ao]);
+
+      int f_lo3[3] = { la3[0], la3[1], la3[2] };
+      int f_hi3[3] = { ha3[0], ha3[1], ha3[2] };
+      f_lo3[ao] = f_hi3[ao] = k;
+
+      for (int iz = f_lo3[2]; iz <= f_hi3[2]; iz++) {
+	for (int iy = f_lo3[1]; iy <= f_hi3[1]; iy++) {
+	  for (int ix = f_lo3[0]; ix <= f_hi3[0]; ix++) {
+	    const int ic = ix + mx*(iy + my*iz) - ms*k;
+	    flux_<T> (ao, nq, ms,
+		      whm + ic, dwm + ic,
+		      wh  + ic, dw + ao*ns + ic,
+		      wl, wr, f);
+	    for (int q = 0; q < nq; q++) {
+	      if (previous) dum[q*ms+ic] -= dtdh*f[q];
+	      if (active)   du [q*ms+ic] += dtdh*f[q];
+	    }
+	  }
+	}
+      }
+    }
+
+    //--------------------------------------------------
+    // Conservative update of active slab k-1
+    //--------------------------------------------------
+
+    if (! previous) continue;
+
+    const T * wu = w_ring + ((k+2)%3)*ns;
+
+    int u_lo3[3] = { la3[0], la3[1], la3[2] };
+    int u_hi3[3] = { ha3[0], ha3[1], ha3[2] };
+    u_lo3[ao] = u_hi3[ao] = k - 1;
+
+    for (int iz = u_lo3[2]; iz <= u_hi3[2]; iz++) {
+      for (int iy = u_lo3[1]; iy <= u_hi3[1]; iy++) {
+	for (int ix = u_lo3[0]; ix <= u_hi3[0]; ix++) {
+
+	  const int i  = ix + mx*(iy + my*iz);
+	  const int ic = i - ms*(k - 1);
+
+	  const T di = wu[0*ms+ic];
+	  T ke = 0;
+	  for (int iv = 0; iv < 3; iv++) ke += wu[(1+iv)*ms+ic]*wu[(1+iv)*ms+ic];
+	  const T ei = wu[4*ms+ic]/gm1 + T(0.5)*di*ke;
+
+	  const T dn = MAX(dmin, di + dum[0*ms+ic]);
+	  T vn[3];
+	  for (int iv = 0; iv < 3; iv++) {
+	    vn[iv] = (di*wu[(1+iv)*ms+ic] + dum[(1+iv)*ms+ic]) / dn;
+	  }
+	  T ten = (ei + dum[4*ms+ic]) / dn;
+
+	  for (int axis = 0; axis < rank; axis++) {
+	    if (a3[axis]) {
+	      const T vg = vn[axis] + dt*a3[axis][i];
+	      ten += T(0.5)*(vg*vg - vn[axis]*vn[axis]);
+	      vn[axis] = vg;
+	    }
+	  }
+
+	  const T kn = T(0.5)*(vn[0]*vn[0] + vn[1]*vn[1] + vn[2]*vn[2]);
+	  ten = MAX(ten, kn + pmin/(gm1*dn));
+
+	  d[i]  = dn;
+	  te[i] = ten;
+	  for (int iv = 0; iv < rank; iv++) v3[iv][i] = vn[iv];
+
+	  for (int icol = 0; icol < nc; icol++) {
+	    colour[icol][i] = di*wu[(5+icol)*ms+ic] + dum[(5+icol)*ms+ic];
+	  }
+	}
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoMethodMuscl::flux_
+(int axis, int nq, int ms,
+ const T * whl, const T * dwl, const T * whr, const T * dwr,
+ T * wl, T * wr, T * f) const throw()
+{
+  const T gamma = gamma_;
+  const T gm1   = gamma - 1;
+  const T dmin  = tiny;
+  const T pmin  = tiny;
+
+  const int j1 = 1 + (axis+1)%3;
+  const int j2 = 1 + (axis+2)%3;
+
+  for (int q = 0; q < nq; q++) {
+    wl[q] = whl[q*ms] + T(0.5)*dwl[q*ms];
+    wr[q] = whr[q*ms] - T(0.5)*dwr[q*ms];
+  }
+  wl[0] = MAX(wl[0],dmin);
+  wr[0] = MAX(wr[0],dmin);
+  wl[4] = MAX(wl[4],pmin);
+  wr[4] = MAX(wr[4],pmin);
+
+  const T dl = wl[0], ul = wl[1+axis], pl = wl[4];
+  const T dr = wr[0], ur = wr[1+axis], pr = wr[4];
+  const T el = pl/gm1 + T(0.5)*dl*
+    (wl[1]*wl[1] + wl[2]*wl[2] + wl[3]*wl[3]);
+  const T er = pr/gm1 + T(0.5)*dr*
+    (wr[1]*wr[1] + wr[2]*wr[2] + wr[3]*wr[3]);
+  const T cl = sqrt(gamma*pl/dl);
+  const T cr = sqrt(gamma*pr/dr);
+
+  const T sl = MIN(ul - cl, ur - cr);
+  const T sr = MAX(ul + cl, ur + cr);
+  const T ss = (pr - pl + dl*ul*(sl - ul) - dr*ur*(sr - ur)) /
+    (dl*(sl - ul) - dr*(sr - ur));
+
+  // upwind side of the contact
+
+  const bool left = (ss >= 0);
+  const T * wk = left ? wl : wr;
+  const T dk = left ? dl : dr;
+  const T uk = left ? ul : ur;
+  const T pk = left ? pl : pr;
+  const T ek = left ? el : er;
+  const T sk = left ? sl : sr;
+
+  const T fd = dk*uk;
+  f[0]      = fd;
+  f[1+axis] = fd*uk + pk;
+  f[j1]     = fd*wk[j1];
+  f[j2]     = fd*wk[j2];
+  f[4]      = (ek + pk)*uk;
+  for (int q = 5; q < nq; q++) f[q] = fd*wk[q];
+
+  // add the jump across the outer wave unless it is upwind of the
+  // face
+
+  const bool star = left ? (sl < 0) : (sr > 0);
+
+  if (star) {
+    const T r = dk*(sk - uk)/(sk - ss);
+    f[0]      += sk*(r - dk);
+    f[1+axis] += sk*(r*ss - dk*uk);
+    f[j1]     += sk*(r - dk)*wk[j1];
+    f[j2]     += sk*(r - dk)*wk[j2];
+    f[4]      += sk*(r*(ek/dk + (ss - uk)*(ss + pk/(dk*(sk - uk))))
+		   - ek);
+    for (int q = 5; q < nq; q++) f[q] += sk*(r - dk)*wk[q];
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+double EnzoMethodMuscl::timestep_ (Block * block) const throw()
+{
+  Data * data = block->data();
+  Field field = data->field();
+
+  const int rank = block->rank();
+
+  FieldView<T> density = field.view<T>(density_);
+
+  const T * d  = density.values();
+  const T * te = field.view<T>(total_energy_).values();
+  const T * v3[3] =
+    { field.view<T>(velocity_[0]).values(),
+      (rank >= 2) ? field.view<T>(velocity_[1]).values() : NULL,
+      (rank >= 3) ? field.view<T>(velocity_[2]).values() : NULL };
+
+  int m3[3];
+  density.dimensions (&m3[0],&m3[1],&m3[2]);
+  int g3[3];
+  density.ghost_depth (&g3[0],&g3[1],&g3[2]);
+  for (int axis = rank; axis < 3; axis++) g3[axis] = 0;
+
+  double xm,ym,zm;
+  data->lower(&xm,&ym,&zm);
+  double xp,yp,zp;
+  data->upper(&xp,&yp,&zp);
+  double h3[3];
+  field.cell_width(xm,xp,&h3[0],
+		   ym,yp,&h3[1],
+		   zm,zp,&h3[2]);
+
+  const T gamma = gamma_;
+  const T pmin  = tiny;
+  const T dmin  = tiny;
+
+  // unsplit stability: dt * sum_axis (|v| + c) / h <= courant
+
+  T rate_max = 0;
+
+  for (int iz = g3[2]; iz < m3[2]-g3[2]; iz++) {
+    for (int iy = g3[1]; iy < m3[1]-g3[1]; iy++) {
+      for (int ix = g3[0]; ix < m3[0]-g3[0]; ix++) {
+	const int i = ix + m3[0]*(iy + m3[1]*iz);
+	const T di = MAX(d[i],dmin);
+	T ke = 0;
+	for (int axis = 0; axis < rank; axis++) ke += v3[axis][i]*v3[axis][i];
+	const T p = MAX(pmin, (gamma - 1)*di*(te[i] - T(0.5)*ke));
+	const T c = sqrt(gamma*p/di);
+	T rate = 0;
+	for (int axis = 0; axis < rank; axis++) {
+	  rate += (fabs(v3[axis][i]) + c) / T(h3[axis]);
+	}
+	rate_max = MAX(rate_max, rate);
+      }
+    }
+  }
+
+  return (rate_max > 0) ?
+    courant_ / rate_max : std::numeric_limits<double>::max();
+}
@@ -19,7 +19,14 @@ class EnzoMethodNull : public Method {
 public: // interface
 
   /// Create a new EnzoMethodNull object
-  EnzoMethodNull(double dt) : dt_(dt) {}
+  EnzoMethodNull(const FieldDescr * field_descr, double dt)
+    : Method(), dt_(dt)
+  {
+    // Refresh all fields, which also applies any flux corrections
+    // still pending from a preceding Method
+    const int ir = add_refresh(4,0,neighbor_leaf,sync_barrier);
+    refresh(ir)->add_all_fields(field_descr->field_count());
+  }
 
   EnzoMethodNull() : dt_ (std::numeric_limits<double>::max()) {}
 
@@ -17,14 +17,63 @@ EnzoMethodPpm::EnzoMethodPpm
  EnzoConfig * enzo_config
 ) 
   : Method(),
-    comoving_coordinates_(enzo_config->physics_cosmology)
+    comoving_coordinates_(enzo_config->physics_cosmology),
+    solver_(enzo_config->ppm_solver),
+    compute_ppm_(NULL),
+    density_(field_descr,"density"),
+    total_energy_(field_descr,"total_energy"),
+    internal_energy_(field_descr,"internal_energy"),
+    pressure_(field_descr,"pressure")
 {
+  velocity_[0]     = FieldHandle(field_descr,"velocity_x");
+  velocity_[1]     = FieldHandle(field_descr,"velocity_y");
+  velocity_[2]     = FieldHandle(field_descr,"velocity_z");
+  acceleration_[0] = FieldHandle(field_descr,"acceleration_x");
+  acceleration_[1] = FieldHandle(field_descr,"acceleration_y");
+  acceleration_[2] = FieldHandle(field_descr,"acceleration_z");
+
   // Initialize default Refresh object
 
   const int ir = add_refresh(4,0,neighbor_leaf,sync_barrier);
   refresh(ir)->add_all_fields(field_descr->field_count());
 
   // PPM parameters initialized in EnzoBlock::initialize()
+
+  // Flux registers hold a single timestep's fluxes, so they are not
+  // accumulated over the finer levels' steps with Adapt:subcycle
+
+  ASSERT ("EnzoMethodPpm::EnzoMethodPpm()",
+	  "Method:ppm:flux_correct is not supported with Adapt:subcycle",
+	  ! (enzo_config->ppm_flux_correct && enzo_config->adapt_subcycle));
+
+  if (solver_ == "cxx") {
+    ASSERT ("EnzoMethodPpm::EnzoMethodPpm()",
+	    "Method:ppm:dual_energy is not supported by the cxx solver",
+	    ! enzo_config->ppm_dual_energy);
+    if (enzo_config->ppm_steepening) {
+      WARNING ("EnzoMethodPpm::EnzoMethodPpm()",
+	       "Method:ppm:steepening is ignored by the cxx solver");
+    }
+    if (enzo_config->ppm_flux_correct) {
+      WARNING ("EnzoMethodPpm::EnzoMethodPpm()",
+	       "Method:ppm:flux_correct is ignored by the cxx solver");
+    }
+    compute_ppm_ = new EnzoComputePpm (field_descr,
+				       enzo_config->field_gamma,
+				       comoving_coordinates_);
+  } else if (solver_ != "fortran") {
+    ERROR1 ("EnzoMethodPpm::EnzoMethodPpm()",
+	    "Unknown Method:ppm:solver \"%s\"",
+	    solver_.c_str());
+  }
+}
+
+//----------------------------------------------------------------------
+
+EnzoMethodPpm::~EnzoMethodPpm () throw()
+{
+  delete compute_ppm_;
+  compute_ppm_ = NULL;
 }
 
 //----------------------------------------------------------------------
@@ -38,6 +87,14 @@ void EnzoMethodPpm::pup (PUP::er &p)
   Method::pup(p);
 
   p | comoving_coordinates_;
+  p | solver_;
+  p | compute_ppm_;
+  p | density_;
+  p | total_energy_;
+  p | internal_energy_;
+  p | pressure_;
+  PUParray(p,velocity_,3);
+  PUParray(p,acceleration_,3);
 }
 
 //----------------------------------------------------------------------
@@ -48,8 +105,18 @@ void EnzoMethodPpm::compute ( Block * block) throw()
 
   if (block->is_leaf()) {
 
-    enzo_block->SolveHydroEquations 
-      ( block->time(), block->dt(), comoving_coordinates_ );
+    if (compute_ppm_) {
+
+      compute_ppm_->compute(block);
+
+    } else {
+
+      enzo_block->SolveHydroEquations 
+	( block->time(), block->dt(), comoving_coordinates_,
+	  density_, total_energy_, internal_energy_,
+	  velocity_, acceleration_ );
+
+    }
 
   }
 
@@ -83,14 +150,14 @@ double EnzoMethodPpm::timestep ( Block * block ) const throw()
 
   int rank = block->rank();
 
-  enzo_float * density    = (enzo_float *)field.values("density");
+  enzo_float * density    = field.view<enzo_float>(density_).values();
   enzo_float * velocity_x = (rank >= 1) ? 
-    (enzo_float *)field.values("velocity_x") : NULL;
+    field.view<enzo_float>(velocity_[0]).values() : NULL;
   enzo_float * velocity_y = (rank >= 2) ? 
-    (enzo_float *)field.values("velocity_y") : NULL;
+    field.view<enzo_float>(velocity_[1]).values() : NULL;
   enzo_float * velocity_z = (rank >= 3) ? 
-    (enzo_float *)field.values("velocity_z") : NULL;
-  enzo_float * pressure = (enzo_float *) field.values("pressure");
+    field.view<enzo_float>(velocity_[2]).values() : NULL;
+  enzo_float * pressure = field.view<enzo_float>(pressure_).values();
  
   /* 2) Calculate dt from particles. */
  
@@ -24,7 +24,12 @@ public: // interface
   PUPable_decl(EnzoMethodPpm);
   
   /// Charm++ PUP::able migration constructor
-  EnzoMethodPpm (CkMigrateMessage *m) {}
+  EnzoMethodPpm (CkMigrateMessage *m)
+    : compute_ppm_(NULL)
+  {}
+
+  /// Destructor
+  virtual ~EnzoMethodPpm() throw();
 
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p);
@@ -41,6 +46,20 @@ public: // interface
 protected: // interface
 
   int comoving_coordinates_;
+
+  /// Hydro solver: "fortran" (ppm_de) or "cxx" (EnzoComputePpm)
+  std::string solver_;
+
+  /// C++ solver if solver_ is "cxx", else NULL
+  Compute * compute_ppm_;
+
+  /// Fields accessed by the method
+  FieldHandle density_;
+  FieldHandle total_energy_;
+  FieldHandle internal_energy_;
+  FieldHandle pressure_;
+  FieldHandle velocity_[3];
+  FieldHandle acceleration_[3];
 };
 
 #endif /* ENZO_ENZO_METHOD_PPM_HPP */
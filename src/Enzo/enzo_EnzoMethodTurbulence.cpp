@@ -20,14 +20,73 @@ EnzoMethodTurbulence::EnzoMethodTurbulence
  double density_initial,
  double temperature_initial,
  double mach_number,
- int comoving_coordinates)
+ int comoving_coordinates,
+ int rank,
+ const std::string & driving,
+ double driving_kmin,
+ double driving_kmax,
+ double driving_correlation_time,
+ double driving_update_interval,
+ int driving_seed,
+ const double lower[3],
+ const double upper[3],
+ bool store_temperature)
   : Method(),
     density_initial_(density_initial),
     temperature_initial_(temperature_initial),
     edot_(edot),
     mach_number_(mach_number),
-    comoving_coordinates_(comoving_coordinates)
+    comoving_coordinates_(comoving_coordinates),
+    store_temperature_(store_temperature),
+    density_(field_descr,"density"),
+    temperature_(field_descr,"temperature"),
+    pressure_(field_descr,"pressure"),
+    total_energy_(field_descr,"total_energy"),
+    rank_(rank),
+    driving_spectral_(driving == "spectral"),
+    driving_kmin_(driving_kmin),
+    driving_kmax_(driving_kmax),
+    driving_correlation_time_(driving_correlation_time),
+    driving_update_interval_(driving_update_interval),
+    driving_random_(driving_seed),
+    driving_step_(0),
+    mode_k_(),
+    mode_a_()
 {
+  velocity_[0] = FieldHandle(field_descr,"velocity_x");
+  velocity_[1] = FieldHandle(field_descr,"velocity_y");
+  velocity_[2] = FieldHandle(field_descr,"velocity_z");
+  driving_[0]  = FieldHandle(field_descr,"driving_x");
+  driving_[1]  = FieldHandle(field_descr,"driving_y");
+  driving_[2]  = FieldHandle(field_descr,"driving_z");
+
+  for (int i=0; i<3; i++) {
+    lower_[i] = lower[i];
+    upper_[i] = upper[i];
+  }
+
+  ASSERT1 ("EnzoMethodTurbulence()",
+	   "Unknown driving type \"%s\": must be \"field\" or \"spectral\"",
+	   driving.c_str(), (driving == "field" || driving == "spectral"));
+
+  if (driving_spectral_) {
+    ASSERT ("EnzoMethodTurbulence()",
+	    "Spectral driving seed must be nonzero",
+	    driving_seed != 0);
+    ASSERT1 ("EnzoMethodTurbulence()",
+	     "Spectral driving update interval %g must be positive",
+	     driving_update_interval,
+	     driving_update_interval > 0.0);
+    driving_initialize_();
+  } else {
+    for (int i=0; i<rank; i++) {
+      ASSERT1 ("EnzoMethodTurbulence()",
+	       "Field driving requires field %s",
+	       (i==0) ? "driving_x" : ((i==1) ? "driving_y" : "driving_z"),
+	       driving_[i].is_field());
+    }
+  }
+
   // Initialize default Refresh object
 
   const int ir = add_refresh(4,0,neighbor_leaf,sync_barrier);
@@ -53,6 +112,25 @@ void EnzoMethodTurbulence::pup (PUP::er &p)
   p | temperature_initial_;
   p | mach_number_;
   p | comoving_coordinates_;
+  p | store_temperature_;
+  p | density_;
+  p | temperature_;
+  p | pressure_;
+  p | total_energy_;
+  PUParray(p,velocity_,3);
+  PUParray(p,driving_,3);
+  p | rank_;
+  p | driving_spectral_;
+  p | driving_kmin_;
+  p | driving_kmax_;
+  p | driving_correlation_time_;
+  p | driving_update_interval_;
+  p | driving_random_;
+  p | driving_step_;
+  PUParray(p,lower_,3);
+  PUParray(p,upper_,3);
+  p | mode_k_;
+  p | mode_a_;
 
 }
 
@@ -65,27 +143,27 @@ void EnzoMethodTurbulence::compute ( Block * block) throw()
   
   Field field = block->data()->field();
 
-  const EnzoConfig * enzo_config = static_cast<const EnzoConfig*>
-    (enzo_block->simulation()->config());
-
-  EnzoComputeTemperature compute_temperature
-    (enzo_config->ppm_density_floor,
-     enzo_config->ppm_temperature_floor,
-     enzo_config->ppm_mol_weight,
-     comoving_coordinates_);
+  enzo_float *  density = field.view<enzo_float>(density_).values();
+  enzo_float *  velocity[3] = {
+    field.view<enzo_float>(velocity_[0]).values(),
+    field.view<enzo_float>(velocity_[1]).values(),
+    field.view<enzo_float>(velocity_[2]).values() };
+  enzo_float * driving[3] = { NULL, NULL, NULL };
+  if (! driving_spectral_) {
+    for (int id=0; id<3; id++) {
+      if (driving_[id].is_field())
+	driving[id] = field.view<enzo_float>(driving_[id]).values();
+    }
+  }
+  enzo_float * total_energy = field.view<enzo_float>(total_energy_).values();
 
-  compute_temperature.compute(enzo_block);
+  // temperature and pressure are computed on the fly, and only stored
+  // if requested
 
-  enzo_float *  density = (enzo_float *) field.values("density");
-  enzo_float *  velocity[3] = {
-    (enzo_float *) field.values("velocity_x"),
-    (enzo_float *) field.values("velocity_y"),
-    (enzo_float *) field.values("velocity_z") };
-  enzo_float * driving[3] = {
-    (enzo_float *) field.values("driving_x"),
-    (enzo_float *) field.values("driving_y"),
-    (enzo_float *) field.values("driving_z") };
-  enzo_float * temperature = (enzo_float *) field.values("temperature");
+  enzo_float * temperature = (store_temperature_ && temperature_.is_field()) ?
+    field.view<enzo_float>(temperature_).values() : NULL;
+  enzo_float * pressure = (store_temperature_ && pressure_.is_field()) ?
+    field.view<enzo_float>(pressure_).values() : NULL;
 
   int nx,ny,nz;
   field.size(&nx,&ny,&nz);
@@ -94,14 +172,7 @@ void EnzoMethodTurbulence::compute ( Block * block) throw()
   int ndx = nx + 2*gx;
   int ndy = ny + 2*gy;
 
-  const int n = sizeof(enzo_block->method_turbulence_data)/sizeof(double);
-  double * g = enzo_block->method_turbulence_data;
-  
-  ASSERT2 ("EnzoMethodTurbulence::compute()",
-	   "Size of EnzoBlock::method_turbulence_data array %d "
-	   "must be at least %d",
-	   n, MAX_TURBULENCE_ARRAY, 
-	   (n >= MAX_TURBULENCE_ARRAY));
+  double g[MAX_TURBULENCE_ARRAY];
 
   for (int i=0; i<MAX_TURBULENCE_ARRAY-2; i++) g[i] = 0.0;
 
@@ -112,72 +183,128 @@ void EnzoMethodTurbulence::compute ( Block * block) throw()
   field.dimensions (0,&mx,&my,&mz);
   const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
 
+  // Bring the spectral driving modes up to the current time
+
+  if (driving_spectral_) driving_advance_(block->time());
+
   if (block->is_leaf()) {
 
+    const EnzoConfig * enzo_config = static_cast<const EnzoConfig*>
+      (enzo_block->simulation()->config());
+
+    // temperature = max (mol_weight * pressure / max(density,
+    // density_floor), temperature_floor), as in EnzoComputeTemperature
+
+    const enzo_float gm1               = EnzoBlock::Gamma - 1.0;
+    const enzo_float density_floor     = enzo_config->ppm_density_floor;
+    const enzo_float temperature_floor = enzo_config->ppm_temperature_floor;
+    const enzo_float mol_weight        = enzo_config->ppm_mol_weight;
+
+    std::vector<double> table;
+    std::vector<enzo_float> row;
+    if (driving_spectral_) {
+      driving_table_(block,nx,ny,nz,table);
+      row.resize(3*nx);
+    }
+
     for (int iz=gz; iz<gz+nz; iz++) {
       for (int iy=gy; iy<gy+ny; iy++) {
-	for (int ix=gx; ix<gx+nx; ix++) {
 
-	  int i = ix + ndx*(iy + ndy*iz);
+	const int i0 = gx + ndx*(iy + ndy*iz);
 
-	  enzo_float d  = density[i];
-	  for (int id=0; id<rank; id++) {
-	    enzo_float v  = velocity[id][i];
-	    enzo_float v2 = v*v;
-	    enzo_float a  = driving[id][i];
-	    enzo_float ti = 1.0 / temperature[i];
-
-	    g[INDEX_TURBULENCE_VAD] +=   v*a*d;
-	    g[INDEX_TURBULENCE_AAD] +=   a*a*d;
-	    g[INDEX_TURBULENCE_VVDoT] += v2*d*ti;
-	    g[INDEX_TURBULENCE_VVoT] +=  v2*ti;
-	    g[INDEX_TURBULENCE_VVD] +=   v2*d;
-	    g[INDEX_TURBULENCE_VV] +=    v2;
-	  }
-	  g[INDEX_TURBULENCE_DD] +=   d*d;
-	  g[INDEX_TURBULENCE_DAx] +=  d*driving[0][i];
-	  g[INDEX_TURBULENCE_DAy] +=  (rank >= 2) ? d*driving[1][i] : 0.0;
-	  g[INDEX_TURBULENCE_DAz] +=  (rank >= 3) ? d*driving[2][i] : 0.0;
-	  g[INDEX_TURBULENCE_DVx] +=  d*velocity[0][i];
-	  g[INDEX_TURBULENCE_DVy] +=  (rank >= 2) ? d*velocity[1][i] : 0.0;
-	  g[INDEX_TURBULENCE_DVz] +=  (rank >= 3) ? d*velocity[2][i] : 0.0;
-	  g[INDEX_TURBULENCE_DlnD] += d*log(d);
-	  g[INDEX_TURBULENCE_minD] =
-	    std::min(g[INDEX_TURBULENCE_minD], (double) d);
-	  g[INDEX_TURBULENCE_maxD] =
-	    std::max(g[INDEX_TURBULENCE_maxD], (double) d);
+	// driving acceleration a3[id][ix] along the row
+
+	const enzo_float * a3[3] = { NULL, NULL, NULL };
+	if (driving_spectral_) {
+	  driving_row_(&table[0],nx,ny,nz,iy-gy,iz-gz,&row[0]);
+	  for (int id=0; id<3; id++) a3[id] = &row[id*nx];
+	} else {
+	  for (int id=0; id<rank; id++) a3[id] = driving[id] + i0;
 	}
-      }
-    }
-  }
-  enzo_block->method_turbulence_begin();
-}
 
-//----------------------------------------------------------------------
+	const enzo_float * d3 = density + i0;
+	const enzo_float * te = total_energy + i0;
+	const enzo_float * v3[3] = { velocity[0] + i0, NULL, NULL };
+	if (rank >= 2) v3[1] = velocity[1] + i0;
+	if (rank >= 3) v3[2] = velocity[2] + i0;
+	enzo_float * t3 = temperature ? temperature + i0 : NULL;
+	enzo_float * p3 = pressure    ? pressure    + i0 : NULL;
 
-extern CkReduction::reducerType r_method_turbulence_type;
+	// accumulate the row in local sums
 
-void EnzoBlock::method_turbulence_begin()
-{
-  const int n = MAX_TURBULENCE_ARRAY * sizeof(double);
-  double * g = method_turbulence_data;
-  CkCallback callback (CkIndex_EnzoBlock::p_method_turbulence_end(NULL),
-		       thisProxy);
-  contribute(n,g,r_method_turbulence_type,callback);
-}
+	double vad = 0.0, aad = 0.0, vvdot = 0.0, vvot = 0.0;
+	double vvd = 0.0, vv = 0.0, dd = 0.0, dlnd = 0.0;
+	double da[3] = {0.0, 0.0, 0.0};
+	double dv[3] = {0.0, 0.0, 0.0};
+	double dmin = g[INDEX_TURBULENCE_minD];
+	double dmax = g[INDEX_TURBULENCE_maxD];
 
-//----------------------------------------------------------------------
+	for (int ix=0; ix<nx; ix++) {
 
-// SEE main.cpp for implementation
+	  const enzo_float d = d3[ix];
 
-// CkReductionMsg * r_method_turbulence(int n, CkReductionMsg ** msgs)
+	  enzo_float v2 = 0.0, va = 0.0, a2 = 0.0;
+	  for (int id=0; id<rank; id++) {
+	    const enzo_float v = v3[id][ix];
+	    const enzo_float a = a3[id][ix];
+	    v2 += v*v;
+	    va += v*a;
+	    a2 += a*a;
+	    da[id] += d*a;
+	    dv[id] += d*v;
+	  }
 
-//----------------------------------------------------------------------
+	  const enzo_float p = gm1 * d * (te[ix] - 0.5*v2);
+	  const enzo_float t = std::max
+	    (enzo_float(p * mol_weight / std::max(d,density_floor)),
+	     temperature_floor);
+	  if (t3) t3[ix] = t;
+	  if (p3) p3[ix] = p;
+
+	  const enzo_float ti = 1.0 / t;
+
+	  vad   += va*d;
+	  aad   += a2*d;
+	  vvdot += v2*d*ti;
+	  vvot  += v2*ti;
+	  vvd   += v2*d;
+	  vv    += v2;
+	  dd    += d*d;
+	  dlnd  += d*log(d);
+	  dmin = std::min(dmin, (double) d);
+	  dmax = std::max(dmax, (double) d);
+	}
 
-void EnzoBlock::p_method_turbulence_end(CkReductionMsg * msg)
-{
-  method()->compute_resume (this,msg);
-  delete msg;
+	g[INDEX_TURBULENCE_VAD]   += vad;
+	g[INDEX_TURBULENCE_AAD]   += aad;
+	g[INDEX_TURBULENCE_VVDoT] += vvdot;
+	g[INDEX_TURBULENCE_VVoT]  += vvot;
+	g[INDEX_TURBULENCE_VVD]   += vvd;
+	g[INDEX_TURBULENCE_VV]    += vv;
+	g[INDEX_TURBULENCE_DD]    += dd;
+	g[INDEX_TURBULENCE_DAx]   += da[0];
+	g[INDEX_TURBULENCE_DAy]   += da[1];
+	g[INDEX_TURBULENCE_DAz]   += da[2];
+	g[INDEX_TURBULENCE_DVx]   += dv[0];
+	g[INDEX_TURBULENCE_DVy]   += dv[1];
+	g[INDEX_TURBULENCE_DVz]   += dv[2];
+	g[INDEX_TURBULENCE_DlnD]  += dlnd;
+	g[INDEX_TURBULENCE_minD]  = dmin;
+	g[INDEX_TURBULENCE_maxD]  = dmax;
+      }
+    }
+  }
+
+  // Reduce the sums, and minD and maxD, in a single reduction
+
+  Reduction reduction;
+  for (int i=0; i<MAX_TURBULENCE_ARRAY-2; i++) {
+    reduction.add (reduce_sum_kahan,g[i]);
+  }
+  reduction.add (reduce_min,g[INDEX_TURBULENCE_minD]);
+  reduction.add (reduce_max,g[INDEX_TURBULENCE_maxD]);
+
+  reduction.contribute (block);
 }
 
 //----------------------------------------------------------------------
@@ -187,11 +314,11 @@ void EnzoMethodTurbulence::compute_resume
  CkReductionMsg * msg) throw()
 {
 
-  EnzoBlock * enzo_block = static_cast<EnzoBlock*> (block);
+  Reduction reduction (msg);
 
-  double * g = enzo_block->method_turbulence_data;
+  double g[MAX_TURBULENCE_ARRAY];
   for (int i=0; i<MAX_TURBULENCE_ARRAY; i++) {
-    g[i] = ((double *)msg->getData())[i];
+    g[i] = reduction.value(i);
   }
 
   Data * data = block->data();
@@ -331,11 +458,11 @@ void EnzoMethodTurbulence::compute_resume
   const int p = field.precision (0);
 
   if      (p == precision_single)    
-    compute_resume_<float> (block,msg);
+    compute_resume_<float> (block,g);
   else if (p == precision_double)    
-    compute_resume_<double> (block,msg);
+    compute_resume_<double> (block,g);
   else if (p == precision_quadruple) 
-    compute_resume_<long double> (block,msg);
+    compute_resume_<long double> (block,g);
 }
 
 //----------------------------------------------------------------------
@@ -343,7 +470,7 @@ void EnzoMethodTurbulence::compute_resume
 template <class T>
 void EnzoMethodTurbulence::compute_resume_ 
 (Block * block,
- CkReductionMsg * msg) throw()
+ const double * g) throw()
 {
 
   // Compute normalization
@@ -356,8 +483,6 @@ void EnzoMethodTurbulence::compute_resume_
   field.size(&ndx,&ndy,&ndz);
   int nd = ndx*ndy*ndz;
 
-  double * g = enzo_block->method_turbulence_data;
-
   double dt = block->dt();
 
   double norm = (edot_ != 0.0) ?
@@ -372,13 +497,15 @@ void EnzoMethodTurbulence::compute_resume_
   field.dimensions (0,&mx,&my,&mz);
   const int rank = ((mz == 1) ? ((my == 1) ? 1 : 2) : 3);
 
-  T * te = (T*) field.values ("total_energy");
-  T * v3[3] = { (T*) field.values ("velocity_x"),
-		(T*) field.values ("velocity_y"),
-		(T*) field.values ("velocity_z") };
-  T * a3[3] = { (T*) field.values ("driving_x"),
-		(T*) field.values ("driving_y"),
-		(T*) field.values ("driving_z") };
+  T * te = field.view<T>(total_energy_).values();
+  T * v3[3] = { field.view<T>(velocity_[0]).values(),
+		field.view<T>(velocity_[1]).values(),
+		field.view<T>(velocity_[2]).values() };
+  T * driving[3] = { NULL, NULL, NULL };
+  if (! driving_spectral_) {
+    for (int id=0; id<rank; id++) 
+      driving[id] = field.view<T>(driving_[id]).values();
+  }
 
   int nx,ny,nz;
   field.size(&nx,&ny,&nz);
@@ -396,15 +523,35 @@ void EnzoMethodTurbulence::compute_resume_
   //  for (int dim = 0; dim <  MetaData->TopGridRank; dim++)
   //	bulkMomentum[dim] = GlobVal[7+dim]/numberOfGridZones;
 
+  std::vector<double> table;
+  std::vector<T> row;
+  if (driving_spectral_) {
+    driving_table_(block,nx,ny,nz,table);
+    row.resize(3*nx);
+  }
+
   for (int iz=gz; iz<gz+nz; iz++) {
     for (int iy=gy; iy<gy+ny; iy++) {
+
+      // driving acceleration a3[id][ix-gx] along the row
+
+      const T * a3[3] = { NULL, NULL, NULL };
+      if (driving_spectral_) {
+	driving_row_(&table[0],nx,ny,nz,iy-gy,iz-gz,&row[0]);
+	for (int id=0; id<3; id++) a3[id] = &row[id*nx];
+      } else {
+	for (int id=0; id<rank; id++) 
+	  a3[id] = driving[id] + gx + nbx*(iy + nby*iz);
+      }
+
       for (int ix=gx; ix<gx+nx; ix++) {
 	int i = ix + nbx*(iy + nby*iz);
 	for (int id=0; id<rank; id++) {
-	  //	  	  te[i] += v3[id][i]*a3[id][i]*norm + 0.5*a3[id][i]*norm*a3[id][i]*norm;
-	  //	  	  v3[id][i] += a3[id][i]*norm;
-	  te[i] += (v3[id][i]*(a3[id][i]-bm[id]))*norm;
-	  v3[id][i] += (a3[id][i]-bm[id])*norm;
+	  const T a = a3[id][ix-gx];
+	  //	  	  te[i] += v3[id][i]*a*norm + 0.5*a*norm*a*norm;
+	  //	  	  v3[id][i] += a*norm;
+	  te[i] += (v3[id][i]*(a-bm[id]))*norm;
+	  v3[id][i] += (a-bm[id])*norm;
 		    
 	}
       }
@@ -414,3 +561,225 @@ void EnzoMethodTurbulence::compute_resume_
   enzo_block->compute_done();
   
 }
+
+//======================================================================
+
+void EnzoMethodTurbulence::driving_initialize_ () throw()
+{
+  // One mode for each +/- k pair with kmin <= |k| <= kmax
+
+  const int kmax = int(driving_kmax_);
+  const int kymax = (rank_ >= 2) ? kmax : 0;
+  const int kzmax = (rank_ >= 3) ? kmax : 0;
+
+  mode_k_.clear();
+
+  for (int kz=-kzmax; kz<=kzmax; kz++) {
+    for (int ky=-kymax; ky<=kymax; ky++) {
+      for (int kx=-kmax; kx<=kmax; kx++) {
+	const double k2 = kx*kx + ky*ky + kz*kz;
+	const bool in_shell = (driving_kmin_*driving_kmin_ <= k2 &&
+			       k2 <= driving_kmax_*driving_kmax_);
+	const bool positive =
+	  (kx > 0) || (kx == 0 && ky > 0) || (kx == 0 && ky == 0 && kz > 0);
+	if (in_shell && positive) {
+	  mode_k_.push_back(kx);
+	  mode_k_.push_back(ky);
+	  mode_k_.push_back(kz);
+	}
+      }
+    }
+  }
+
+  const int num_modes = mode_k_.size() / 3;
+
+  ASSERT2 ("EnzoMethodTurbulence::driving_initialize_()",
+	   "No driving modes with %g <= |k| <= %g",
+	   driving_kmin_,driving_kmax_,
+	   num_modes > 0);
+
+  // Start from the stationary distribution of the amplitudes
+
+  mode_a_.resize(6*num_modes);
+
+  for (int m=0; m<num_modes; m++) {
+    for (int id=0; id<3; id++) {
+      const bool active = (id < rank_);
+      mode_a_[6*m+2*id]   = active ? driving_gaussian_() : 0.0;
+      mode_a_[6*m+2*id+1] = active ? driving_gaussian_() : 0.0;
+    }
+    driving_solenoidal_(m);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulence::driving_update_ (double dt) throw()
+{
+  // Ornstein-Uhlenbeck step with unit variance: the amplitudes are
+  // constant for an infinite correlation time
+
+  const double f = exp(-dt/driving_correlation_time_);
+  const double s = sqrt(1.0 - f*f);
+
+  if (s == 0.0) return;
+
+  const int num_modes = mode_k_.size() / 3;
+
+  for (int m=0; m<num_modes; m++) {
+    for (int id=0; id<rank_; id++) {
+      mode_a_[6*m+2*id]   = f*mode_a_[6*m+2*id]   + s*driving_gaussian_();
+      mode_a_[6*m+2*id+1] = f*mode_a_[6*m+2*id+1] + s*driving_gaussian_();
+    }
+    driving_solenoidal_(m);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulence::driving_advance_ (double time) throw()
+{
+  // The number of updates depends only on the time, which is the same
+  // for all Blocks since the Method does not allow subcycling, so a
+  // process that missed cycles replays the same updates as the others
+
+  const double steps = floor(time / driving_update_interval_);
+
+  while (driving_step_ < steps) {
+    driving_update_(driving_update_interval_);
+    ++driving_step_;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulence::driving_solenoidal_ (int m) throw()
+{
+  const int * k = &mode_k_[3*m];
+  double * a = &mode_a_[6*m];
+
+  const double k2 = k[0]*k[0] + k[1]*k[1] + k[2]*k[2];
+
+  // real and imaginary parts: a <-- a - k (k.a) / |k|^2
+
+  for (int part=0; part<2; part++) {
+    const double ka = (k[0]*a[part] + k[1]*a[2+part] + k[2]*a[4+part]) / k2;
+    for (int id=0; id<3; id++) a[2*id+part] -= ka*k[id];
+  }
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodTurbulence::driving_gaussian_ () throw()
+{
+  // xorshift32 uniform deviates in (0,1), so the sequence is the same
+  // on every process and platform
+
+  double u[2];
+  for (int i=0; i<2; i++) {
+    unsigned int x = driving_random_;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    driving_random_ = x;
+    u[i] = (x + 0.5) / 4294967296.0;
+  }
+
+  // Box-Muller transform
+
+  return sqrt(-2.0*log(u[0])) * cos(2.0*cello::pi*u[1]);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulence::driving_table_ 
+(Block * block, int nx, int ny, int nz,
+ std::vector<double> & table) const throw()
+{
+  // For each mode the table holds cos and sin of 2*pi*k*x/L at the
+  // cell centers along x, then y, then z
+
+  double lower[3];
+  block->data()->lower(&lower[0],&lower[1],&lower[2]);
+  double h[3];
+  block->data()->field_cell_width(&h[0],&h[1],&h[2]);
+
+  const int n3[3] = {nx,ny,nz};
+  const int num_modes = mode_k_.size() / 3;
+
+  table.resize(2*num_modes*(nx+ny+nz));
+
+  double * t = &table[0];
+
+  for (int m=0; m<num_modes; m++) {
+    for (int axis=0; axis<3; axis++) {
+
+      const int n = n3[axis];
+      double * c = t;
+      double * s = t + n;
+
+      const double w = 2.0*cello::pi*mode_k_[3*m+axis] /
+	(upper_[axis] - lower_[axis]);
+
+      const double theta = (axis < rank_) ?
+	w*(lower[axis] + 0.5*h[axis] - lower_[axis]) : 0.0;
+      const double cd = cos(w*h[axis]);
+      const double sd = sin(w*h[axis]);
+
+      c[0] = cos(theta);
+      s[0] = sin(theta);
+      for (int i=1; i<n; i++) {
+	c[i] = c[i-1]*cd - s[i-1]*sd;
+	s[i] = s[i-1]*cd + c[i-1]*sd;
+      }
+
+      t += 2*n;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void EnzoMethodTurbulence::driving_row_
+(const double * table, int nx, int ny, int nz,
+ int iy, int iz, T * a) const throw()
+{
+  for (int i=0; i<3*nx; i++) a[i] = 0.0;
+
+  const int num_modes = mode_k_.size() / 3;
+
+  for (int m=0; m<num_modes; m++) {
+
+    const double * t = table + 2*m*(nx+ny+nz);
+
+    const double * cx = t;
+    const double * sx = t + nx;
+    const double cy = t[2*nx + iy];
+    const double sy = t[2*nx + ny + iy];
+    const double cz = t[2*nx + 2*ny + iz];
+    const double sz = t[2*nx + 2*ny + nz + iz];
+
+    // exp(i*(ky*y + kz*z))
+
+    const double qr = cy*cz - sy*sz;
+    const double qi = sy*cz + cy*sz;
+
+    for (int id=0; id<rank_; id++) {
+
+      // p = amplitude * exp(i*(ky*y + kz*z))
+
+      const double ar = mode_a_[6*m+2*id];
+      const double ai = mode_a_[6*m+2*id+1];
+      const T p_re = ar*qr - ai*qi;
+      const T p_im = ar*qi + ai*qr;
+
+      // a += Re (p * exp(i*kx*x))
+
+      T * ad = a + id*nx;
+      for (int ix=0; ix<nx; ix++) {
+	ad[ix] += p_re*cx[ix] - p_im*sx[ix];
+      }
+    }
+  }
+}
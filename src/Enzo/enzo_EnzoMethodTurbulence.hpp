@@ -16,6 +16,22 @@ class EnzoMethodTurbulence : public Method {
   /// @class    EnzoMethodTurbulence
   /// @ingroup  Enzo
   /// @brief    [\ref Enzo] Encapsulate Enzo's TURBULENCE hydro method
+  ///
+  /// With "field" driving the acceleration is read from the driving_x,
+  /// driving_y, and driving_z fields set by EnzoInitialTurbulence.
+  /// With "spectral" driving the Method instead keeps a table of the
+  /// solenoidal Fourier modes with kmin <= |k| <= kmax, whose complex
+  /// amplitudes follow an Ornstein-Uhlenbeck process with the given
+  /// correlation time, and evaluates the acceleration one row of cells
+  /// at a time.  The amplitudes are advanced at fixed intervals of
+  /// simulation time with the same random sequence, and each process
+  /// catches up to the current time before using the table, so all
+  /// Blocks see the same forcing even on processes that had no Blocks
+  /// for some cycles.
+  ///
+  /// The temperature and all statistics are computed in a single
+  /// pass over each Block; the temperature and pressure fields, if
+  /// defined, are only written if store_temperature is true.
 
 public: // interface
 
@@ -25,7 +41,17 @@ public: // interface
 		       double density_initial,
 		       double temperature_initial,
 		       double mach_number,
-		       int comoving_coordinates);
+		       int comoving_coordinates,
+		       int rank,
+		       const std::string & driving,
+		       double driving_kmin,
+		       double driving_kmax,
+		       double driving_correlation_time,
+		       double driving_update_interval,
+		       int driving_seed,
+		       const double lower[3],
+		       const double upper[3],
+		       bool store_temperature);
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodTurbulence);
@@ -42,6 +68,10 @@ public: // interface
   virtual std::string name () throw () 
   { return "turbulence"; }
 
+  /// Not with subcycling: statistics are reduced over all Blocks
+  virtual bool allow_subcycle () const throw()
+  { return false; }
+
   /// Resume computation after a reduction
   virtual void compute_resume ( Block * block,
 				CkReductionMsg * msg) throw(); 
@@ -49,7 +79,33 @@ public: // interface
 private: // methods
 
   template <class T>
-  void compute_resume_ (Block * block, CkReductionMsg * msg) throw();
+  void compute_resume_ (Block * block, const double * g) throw();
+
+  /// Create the spectral driving mode table with random amplitudes
+  void driving_initialize_ () throw();
+
+  /// Advance the mode amplitudes by dt
+  void driving_update_ (double dt) throw();
+
+  /// Advance the mode amplitudes by whole update intervals up to time
+  void driving_advance_ (double time) throw();
+
+  /// Remove the component of mode m's amplitudes parallel to k
+  void driving_solenoidal_ (int m) throw();
+
+  /// Return a normally distributed random number
+  double driving_gaussian_ () throw();
+
+  /// Compute exp(i*2*pi*k*x/L) along each axis of the Block for each
+  /// mode using sin/cos recurrences
+  void driving_table_ (Block * block, int nx, int ny, int nz,
+		       std::vector<double> & table) const throw();
+
+  /// Evaluate the acceleration along the row (iy,iz) of the Block
+  /// interior, storing component id at a[id*nx + ix]
+  template <class T>
+  void driving_row_ (const double * table, int nx, int ny, int nz,
+		     int iy, int iz, T * a) const throw();
 
 private: // attributes
 
@@ -67,6 +123,50 @@ private: // attributes
 
   // Comoving Coordinates
   int comoving_coordinates_;
+
+  // Whether to write the temperature and pressure fields
+  bool store_temperature_;
+
+  // Fields accessed by the method
+  FieldHandle density_;
+  FieldHandle temperature_;
+  FieldHandle pressure_;
+  FieldHandle total_energy_;
+  FieldHandle velocity_[3];
+  FieldHandle driving_[3];
+
+  // Dimensionality of the problem
+  int rank_;
+
+  // Whether the acceleration is computed from the mode table rather
+  // than read from the driving fields
+  bool driving_spectral_;
+
+  // Range of wavenumbers |k| in units of 2 pi / L
+  double driving_kmin_;
+  double driving_kmax_;
+
+  // Ornstein-Uhlenbeck correlation time of the mode amplitudes
+  double driving_correlation_time_;
+
+  // Simulation time between updates of the mode amplitudes
+  double driving_update_interval_;
+
+  // State of the random number generator
+  unsigned int driving_random_;
+
+  // Number of updates applied to the mode amplitudes
+  int driving_step_;
+
+  // Domain extents
+  double lower_[3];
+  double upper_[3];
+
+  // Wavevector (kx,ky,kz) of each mode
+  std::vector<int> mode_k_;
+
+  // Real and imaginary amplitudes of each component of each mode
+  std::vector<double> mode_a_;
 };
 
 #endif /* ENZO_ENZO_METHOD_TURBULENCE_HPP */
@@ -177,13 +177,35 @@ Method * EnzoProblem::create_method_
     method = new EnzoMethodHeat
       (field_descr,
        enzo_config->method_heat_alpha,
-       enzo_config->field_courant);
+       enzo_config->field_courant,
+       enzo_config->method_heat_substeps);
+  } else if (name == "heat_implicit") {
+    // The CG search directions take their ghost zones from the
+    // Boundary of each CG field rather than that of temperature, so
+    // only periodic boundaries give a consistent linear system
+    ASSERT ("EnzoProblem::create_method_()",
+	    "Method:heat_implicit requires periodic boundary conditions",
+	    is_periodic());
+    int rank = config->mesh_root_rank;
+    method = new EnzoMethodHeatImplicit
+      (field_descr, rank,
+       enzo_config->method_heat_implicit_alpha,
+       enzo_config->method_heat_implicit_theta,
+       enzo_config->method_heat_implicit_dt,
+       enzo_config->method_heat_implicit_iter_max,
+       enzo_config->method_heat_implicit_res_tol,
+       enzo_config->method_heat_implicit_monitor_iter);
+  } else if (name == "muscl") {
+    method = new EnzoMethodMuscl
+      (field_descr,
+       enzo_config);
   } else if (name == "null") {
     method = new EnzoMethodNull
-      (enzo_config->method_null_dt);
+      (field_descr,
+       enzo_config->method_null_dt);
 #ifdef CONFIG_USE_GRACKLE
   } else if (name == "grackle") {
-    method = new EnzoMethodGrackle (enzo_config);
+    method = new EnzoMethodGrackle (field_descr,enzo_config);
 #endif /* CONFIG_USE_GRACKLE */
   } else if (name == "turbulence") {
     method = new EnzoMethodTurbulence 
@@ -192,7 +214,17 @@ Method * EnzoProblem::create_method_
        enzo_config->initial_turbulence_density,
        enzo_config->initial_turbulence_temperature,
        enzo_config->method_turbulence_mach_number,
-       enzo_config->physics_cosmology);
+       enzo_config->physics_cosmology,
+       config->mesh_root_rank,
+       enzo_config->method_turbulence_driving,
+       enzo_config->method_turbulence_driving_kmin,
+       enzo_config->method_turbulence_driving_kmax,
+       enzo_config->method_turbulence_driving_correlation_time,
+       enzo_config->method_turbulence_driving_update_interval,
+       enzo_config->method_turbulence_driving_seed,
+       config->domain_lower,
+       config->domain_upper,
+       enzo_config->method_turbulence_store_temperature);
   } else if (name == "gravity_cg") {
     const bool is_singular = is_periodic();
     int rank = config->mesh_root_rank;
@@ -135,13 +135,23 @@ void EnzoRefineShock::evaluate_block_
 {
   const int d3[3] = {1, ndx, ndx*ndy};
 
-  for (int axis=0; axis<rank; axis++) {
+  bool refine  = *any_refine;
+  bool coarsen = *all_coarsen;
 
-    for (int iz=gz; iz<nz+gz; iz++) {
-      for (int iy=gy; iy<ny+gy; iy++) {
-	for (int ix=gx; ix<nx+gx; ix++) {
+  // Single unit-stride pass over the block for all axes, returning
+  // after any row that refines unless the output field is needed
+
+  for (int iz=gz; iz<nz+gz; iz++) {
+    for (int iy=gy; iy<ny+gy; iy++) {
+      for (int ix=gx; ix<nx+gx; ix++) {
+
+	int i = ix + ndx*(iy + ndy*iz);
+
+	T e  = p[i]/(gamma_ - 1.0);
+	T e0 = te[i]*de[i];
+
+	for (int axis=0; axis<rank; axis++) {
 
-	  int i = ix + ndx*(iy + ndy*iz);
 	  int id = d3[axis];
 
 	  T dp = fabs    (p[i+id] - p[i-id]) 
@@ -149,10 +159,7 @@ void EnzoRefineShock::evaluate_block_
 
 	  T dv = v3[axis][i+id] - v3[axis][i-id];
 
-	  T e = p[i]/(gamma_ - 1.0);
-
 	  T ep = te[i+id]*de[i+id];
-	  T e0 = te[i]   *de[i];
 	  T em = te[i-id]*de[i-id];
 
 	  T er = e / std::max (std::max(em,e0),ep);
@@ -165,8 +172,8 @@ void EnzoRefineShock::evaluate_block_
 	    (dp > pressure_max_coarsen_) &&
 	    (er > energy_ratio_max_coarsen_);
 
-	  if (l_refine)  *any_refine = true;
-	  if (l_same)    *all_coarsen = false;
+	  if (l_refine)  refine  = true;
+	  if (l_same)    coarsen = false;
 
 	  if (output) {
 	    if (l_same)   output[i] =  0;
@@ -174,8 +181,16 @@ void EnzoRefineShock::evaluate_block_
 	  }
 	}
       }
+      if (refine && ! output) {
+	*any_refine  = true;
+	*all_coarsen = false;
+	return;
+      }
     }
   }
+
+  *any_refine  = refine;
+  *all_coarsen = coarsen;
 }
 //======================================================================
 
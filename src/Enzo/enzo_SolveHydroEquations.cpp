@@ -9,18 +9,43 @@
 
 #include "enzo.hpp"
 
+/// PPM slice temporaries, grown as needed and shared by all Blocks on
+/// a PE rather than kept per Block.  __thread since Charm++ SMP PEs
+/// are threads of one process
+static __thread std::vector<enzo_float> * hydro_temp = NULL;
+
+//----------------------------------------------------------------------
+
+enzo_float * EnzoBlock::hydro_temp_ (int size) throw()
+{
+  if (hydro_temp == NULL) hydro_temp = new std::vector<enzo_float>;
+  if ((int)hydro_temp->size() < size) hydro_temp->resize(size);
+  return &(*hydro_temp)[0];
+}
+
+//----------------------------------------------------------------------
+
 int EnzoBlock::SolveHydroEquations 
 (
  enzo_float time,
  enzo_float dt,
- int comoving_coordinates
+ int comoving_coordinates,
+ const FieldHandle & density_handle,
+ const FieldHandle & total_energy_handle,
+ const FieldHandle & internal_energy_handle,
+ const FieldHandle velocity_handle[3],
+ const FieldHandle acceleration_handle[3]
  )
 {
-  int NumberOfSubgrids = 0;
+  // Fluxes across the Block's faces are saved for flux correction as
+  // a single "subgrid" covering the whole active region
+
+  int NumberOfSubgrids =
+    (PPMFluxCorrection && flux_register_needed_()) ? 1 : 0;
 
   /* initialize */
 
-  int dim, i,j,  size;
+  int dim, i, size;
   enzo_float a = 1, dadt;
 
   Field field = data()->field();
@@ -36,22 +61,22 @@ int EnzoBlock::SolveHydroEquations
   // colourpt: the color 'array' (contains all color fields)
   enzo_float * colourpt = (enzo_float *) field.permanent();
 
-  // coloff: offsets into the color array (for each color field)
-  int * coloff   = new int [ncolour];
-  int index_colour = 0;
-  for (int index_field = 0;
-       index_field < field.field_count();
-       index_field++) {
-    std::string name = field.field_name(index_field);
-    if (field.groups()->is_in(name,"colour")) {
-      coloff[index_colour++] 
-	= (enzo_float *)(field.values(index_field)) - colourpt;
+  // coloff: offsets into the color array (for each color field),
+  // cached since the field layout is fixed for the Block's lifetime
+  if (! colour_offset_set_) {
+    colour_offset_.clear();
+    for (int index_field = 0;
+	 index_field < field.field_count();
+	 index_field++) {
+      std::string name = field.field_name(index_field);
+      if (field.groups()->is_in(name,"colour")) {
+	colour_offset_.push_back
+	  ((enzo_float *)(field.values(index_field)) - colourpt);
+      }
     }
-
+    colour_offset_set_ = true;
   }
-
-  // No subgrids, so colindex is NULL
-  int *colindex         = NULL;
+  int * coloff = (ncolour > 0) ? &colour_offset_[0] : NULL;
 
   /* Compute size (in enzo_floats) of the current grid. */
 
@@ -61,28 +86,35 @@ int EnzoBlock::SolveHydroEquations
   for (dim = 0; dim < rank; dim++)
     size *= GridDimension[dim];
 
-  enzo_float * density         = (enzo_float *) field.values("density");
-  enzo_float * total_energy    = (enzo_float *) field.values("total_energy");
-  enzo_float * internal_energy = (enzo_float *) field.values("internal_energy");
-  enzo_float * velocity_x      = (rank >= 1) ? 
-    (enzo_float *) field.values("velocity_x") : new enzo_float[size];
-  enzo_float * velocity_y      = (rank >= 2) ? 
-    (enzo_float *) field.values("velocity_y") : new enzo_float[size];
-  enzo_float * velocity_z      = (rank >= 3) ?
-    (enzo_float *) field.values("velocity_z") : new enzo_float[size];
-  enzo_float * acceleration_x  = field.is_field("acceleration_x") ? 
-    (enzo_float *) field.values("acceleration_x") : NULL;
-  enzo_float * acceleration_y  = field.is_field("acceleration_y") ? 
-    (enzo_float *)field.values("acceleration_y") : NULL;
-  enzo_float * acceleration_z  = field.is_field("acceleration_z") ? 
-    (enzo_float *)field.values("acceleration_z") : NULL;
-
-  /* velocity_x must exist, but if y & z aren't present, then create blank
+  enzo_float * density         =
+    field.view<enzo_float>(density_handle).values();
+  enzo_float * total_energy    =
+    field.view<enzo_float>(total_energy_handle).values();
+  enzo_float * internal_energy =
+    field.view<enzo_float>(internal_energy_handle).values();
+
+  /* velocity_x must exist, but if y & z aren't present, then use blank
      buffers for them (since the solver needs to advect something). */
 
-  if (rank < 1) {
-    for (int i=0; i<size; i++) velocity_x[i] = 0.0;
+  if (rank < 3 && (int)hydro_velocity_.size() < 2*size) {
+    hydro_velocity_.resize(2*size);
   }
+  enzo_float * velocity_x      =
+    field.view<enzo_float>(velocity_handle[0]).values();
+  enzo_float * velocity_y      = (rank >= 2) ? 
+    field.view<enzo_float>(velocity_handle[1]).values() : &hydro_velocity_[0];
+  enzo_float * velocity_z      = (rank >= 3) ?
+    field.view<enzo_float>(velocity_handle[2]).values() : &hydro_velocity_[size];
+
+  // Undefined acceleration handles give NULL arrays
+
+  enzo_float * acceleration_x  =
+    field.view<enzo_float>(acceleration_handle[0]).values();
+  enzo_float * acceleration_y  =
+    field.view<enzo_float>(acceleration_handle[1]).values();
+  enzo_float * acceleration_z  =
+    field.view<enzo_float>(acceleration_handle[2]).values();
+
   if (rank < 2) {
     for (int i=0; i<size; i++) velocity_y[i] = 0.0;
   }
@@ -90,12 +122,6 @@ int EnzoBlock::SolveHydroEquations
     for (int i=0; i<size; i++) velocity_z[i] = 0.0;
   }
 
-  /* Determine if Gamma should be a scalar or a field. */
-
-  enzo_float *GammaField;
-  GammaField = new enzo_float[1];
-  GammaField[0] = Gamma;
-
   /* Set minimum support. */
 
   enzo_float MinimumSupportEnergyCoefficient = 0;
@@ -106,62 +132,6 @@ int EnzoBlock::SolveHydroEquations
       return ENZO_FAIL;
     }
 
-  /* allocate space for fluxes */
-
-  SubgridFluxes = new fluxes *[NumberOfSubgrids];
-
-  for (i = 0; i < NumberOfSubgrids; i++) {
-    SubgridFluxes[i] = new fluxes;
-      
-    for (dim = 0; dim < rank; dim++)  {
-
-      /* compute size (in enzo_floats) of flux storage */
-
-      size = 1;
-      for (j = 0; j < rank; j++)
-	size *= SubgridFluxes[i]->LeftFluxEndGlobalIndex[dim][j] -
-	  SubgridFluxes[i]->LeftFluxStartGlobalIndex[dim][j] + 1;
-
-      /* set unused dims (for the solver, which is hardwired for 3d). */
-
-      for (j = rank; j < 3; j++) {
-	SubgridFluxes[i]->LeftFluxStartGlobalIndex[dim][j] = 0;
-	SubgridFluxes[i]->LeftFluxEndGlobalIndex[dim][j] = 0;
-	SubgridFluxes[i]->RightFluxStartGlobalIndex[dim][j] = 0;
-	SubgridFluxes[i]->RightFluxEndGlobalIndex[dim][j] = 0;
-      }
-
-      /* Allocate space (if necessary). */
-
-      for (int field = 0; field < NumberOfBaryonFields; field++) {
-	if (SubgridFluxes[i]->LeftFluxes[field][dim] == NULL)
-	  SubgridFluxes[i]->LeftFluxes[field][dim]  = new enzo_float[size];
-	if (SubgridFluxes[i]->RightFluxes[field][dim] == NULL)
-	  SubgridFluxes[i]->RightFluxes[field][dim] = new enzo_float[size];
-	for (int n = 0; n < size; n++) {
-	  SubgridFluxes[i]->LeftFluxes[field][dim][n] = 0;
-	  SubgridFluxes[i]->RightFluxes[field][dim][n] = 0;
-	}
-      }
-
-      for (int field = NumberOfBaryonFields; field < MAX_NUMBER_OF_BARYON_FIELDS;
-	   field++) {
-	SubgridFluxes[i]->LeftFluxes[field][dim] = NULL;
-	SubgridFluxes[i]->RightFluxes[field][dim] = NULL;
-      }
-
-    }  // next dimension
-
-    /* make things pretty */
-
-    for (dim = rank; dim < 3; dim++)
-      for (int field = 0; field < MAX_NUMBER_OF_BARYON_FIELDS; field++) {
-	SubgridFluxes[i]->LeftFluxes[field][dim] = NULL;
-	SubgridFluxes[i]->RightFluxes[field][dim] = NULL;
-      }
-
-  } // end of loop over subgrids
-
   /* fix grid quantities so they are defined to at least 3 dims */
 
   for (i = rank; i < 3; i++) {
@@ -177,14 +147,14 @@ int EnzoBlock::SolveHydroEquations
   int tempsize = MAX(MAX(GridDimension[0]*GridDimension[1],
 			 GridDimension[1]*GridDimension[2]),
 		     GridDimension[2]*GridDimension[0]);
-  enzo_float *temp = new enzo_float[tempsize*(31+ncolour*4)];
+  enzo_float *temp = hydro_temp_(tempsize*(31+ncolour*4));
 
   /* create and fill in arrays which are easier for the solver to
      understand. */
 
   size = NumberOfSubgrids*3*(18+2*ncolour) + 1;
-  int * array = new int[size];
-  for (int i=0; i<size; i++) array[i] = 0;
+  hydro_index_.assign(size,0);
+  int * array = &hydro_index_[0];
 
   int *leftface  = array + NumberOfSubgrids*3*0;
   int *rightface = array + NumberOfSubgrids*3*1;
@@ -198,9 +168,65 @@ int EnzoBlock::SolveHydroEquations
   int *vindex    = array + NumberOfSubgrids*3*12;
   int *windex    = array + NumberOfSubgrids*3*14;
   int *geindex   = array + NumberOfSubgrids*3*16;
+  int *colindex  = (NumberOfSubgrids > 0) ?
+    array + NumberOfSubgrids*3*18 : NULL;
+
+  enzo_float standard_empty[1];
+  enzo_float *standard = standard_empty;
+
+  /* Set the face and flux slice indices of the "subgrid", and the
+     offsets of each flux into flux_register_, which is passed to the
+     solver as the flux array. */
+
+  if (NumberOfSubgrids > 0) {
+
+    flux_register_.assign(flux_register_offset_(rank,0,0,ncolour),0.0);
+
+    for (dim = 0; dim < rank; dim++) {
+
+      /* the flux slice for dim = 0 spans dims 1,2; for dim = 1 it
+	 spans dims 0,2; and for dim = 2 it spans dims 0,1 */
+
+      int idim = (dim == 0) ? 1 : 0;
+      int jdim = (dim == 2) ? 1 : 2;
+
+      leftface[dim]  = GridStartIndex[dim];
+      rightface[dim] = GridEndIndex[dim];
+      istart[dim]    = GridStartIndex[idim];
+      iend[dim]      = GridEndIndex[idim];
+      jstart[dim]    = GridStartIndex[jdim];
+      jend[dim]      = GridEndIndex[jdim];
+
+      for (int face = 0; face < 2; face++) {
+	dindex [dim*2+face] =
+	  flux_register_offset_(dim,face,flux_density,ncolour);
+	Eindex [dim*2+face] =
+	  flux_register_offset_(dim,face,flux_total_energy,ncolour);
+	uindex [dim*2+face] =
+	  flux_register_offset_(dim,face,flux_velocity_x,ncolour);
+	vindex [dim*2+face] =
+	  flux_register_offset_(dim,face,flux_velocity_y,ncolour);
+	windex [dim*2+face] =
+	  flux_register_offset_(dim,face,flux_velocity_z,ncolour);
+	geindex[dim*2+face] =
+	  flux_register_offset_(dim,face,flux_internal_energy,ncolour);
+	for (int ic = 0; ic < ncolour; ic++) {
+	  colindex[dim*2+face + 6*ic] =
+	    flux_register_offset_(dim,face,flux_colour+ic,ncolour);
+	}
+      }
+    }
 
-  enzo_float standard[1];
-  //    enzo_float *standard = SubgridFluxes[0]->LeftFluxes[0][0];
+    standard = &flux_register_[0];
+
+  } else {
+
+    flux_register_.clear();
+
+  }
+
+  flux_register_sent_ = 0;
+  flux_register_cycle_ = cycle();
 
   /* If using comoving coordinates, multiply dx by a(n+1/2).
      In one fell swoop, this recasts the equations solved by solver
@@ -235,7 +261,22 @@ int EnzoBlock::SolveHydroEquations
   //     AccelerationField[1] = density;
   //     AccelerationField[2] = density;
   int gravity_on = (acceleration_x != NULL) ? 1 : 0;
-  
+
+  if (PPMSweepThreads > 1) {
+
+    /* distribute the slices of each sweep over threads */
+
+    SolvePPMSweeps
+      (density, total_energy, velocity_x, velocity_y, velocity_z,
+       internal_energy,
+       gravity_on, acceleration_x, acceleration_y, acceleration_z,
+       dt, CellWidthTemp, ncolour, colourpt, coloff, colindex,
+       standard, NumberOfSubgrids, leftface, rightface,
+       istart, iend, jstart, jend,
+       dindex, Eindex, uindex, vindex, windex, geindex);
+
+  } else {
+
   FORTRAN_NAME(ppm_de)
     (
      density, total_energy, velocity_x, velocity_y, velocity_z,
@@ -260,20 +301,7 @@ int EnzoBlock::SolveHydroEquations
      &ncolour, colourpt, coloff, colindex
      );
 
-  /* deallocate temporary space for solver */
-
-  delete [] temp;
-  if (rank < 2) delete [] velocity_y;
-  if (rank < 3) delete [] velocity_z;
-
-  delete [] leftface;
-  delete [] GammaField;
-
-  for (int i=0; i<NumberOfSubgrids; i++) {
-    delete SubgridFluxes[i];
   }
-  delete [] SubgridFluxes;
-  delete [] coloff;
 
   return ENZO_SUCCESS;
 
@@ -0,0 +1,160 @@
+// See LICENSE_ENZO file for license and copyright information
+
+/// @file      enzo_SolvePPMSweeps.cpp
+/// @author    James Bordner (jobordner@ucsd.edu)
+/// @date      2026-10-19
+/// @brief     Slice-parallel driver for the PPM x/y/z Euler sweeps
+///
+/// Reproduces the directional splitting loop in ppm_de.F, but
+/// distributes the independent 2D slices of each sweep over
+/// PPMSweepThreads OpenMP threads, each with its own slice scratch
+/// space.  Without CONFIG_USE_OPENMP the slices are swept serially.
+
+#include "cello.hpp"
+
+#include "enzo.hpp"
+
+#ifdef CONFIG_USE_OPENMP
+#  include <omp.h>
+#endif
+
+//----------------------------------------------------------------------
+
+/// Argument list shared by x/y/zeuler_sweep() following the slice index
+
+#define EULER_SWEEP_ARGS(GR_ACC,T)					\
+  d, E, u, v, w, ge, &in, &jn, &kn,					\
+    &gravity, GR_ACC, &DualEnergyFormalism, &eta1, &eta2,		\
+    &is, &ie, &js, &je, &ks, &ke,					\
+    &gamma, &pmin, &dt, &dx[0], &dx[1], &dx[2],			\
+    &PPMDiffusionParameter, &PPMFlatteningParameter,			\
+    &PPMSteepeningParameter, &PressureFree,				\
+    &nsubgrids, leftface, rightface,					\
+    istart, iend, jstart, jend,						\
+    dindex, Eindex, geindex, uindex, vindex, windex, standard,		\
+    &ncolour, colourpt, coloff, colindex,				\
+    T+ms*0,  T+ms*1,  T+ms*2,  T+ms*3,  T+ms*4,  T+ms*5,		\
+    T+ms*6,  T+ms*7,  T+ms*8,  T+ms*9,  T+ms*10, T+ms*11,		\
+    T+ms*12, T+ms*13, T+ms*14, T+ms*15, T+ms*16, T+ms*17,		\
+    T+ms*18, T+ms*19, T+ms*20, T+ms*21, T+ms*22, T+ms*23,		\
+    T+ms*24, T+ms*25, T+ms*26, T+ms*27, T+ms*28, T+ms*29,		\
+    T+ms*(30+0*ncolour), T+ms*(30+1*ncolour),				\
+    T+ms*(30+2*ncolour), T+ms*(30+3*ncolour)
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::SolvePPMSweeps
+(enzo_float *d, enzo_float *E, enzo_float *u, enzo_float *v, enzo_float *w,
+ enzo_float *ge, int gravity,
+ enzo_float *gr_ax, enzo_float *gr_ay, enzo_float *gr_az,
+ enzo_float dt, enzo_float dx[], int ncolour, enzo_float *colourpt,
+ int *coloff, int *colindex, enzo_float *standard,
+ int nsubgrids, int *leftface, int *rightface,
+ int *istart, int *iend, int *jstart, int *jend,
+ int *dindex, int *Eindex, int *uindex, int *vindex, int *windex,
+ int *geindex)
+{
+  const int rank = this->rank();
+
+  // Convert to the one-based Fortran indices used by the sweeps
+  // (GridDimension etc. have already been padded to three dimensions)
+
+  int in = GridDimension[0];
+  int jn = GridDimension[1];
+  int kn = GridDimension[2];
+  int is = GridStartIndex[0] + 1;
+  int js = GridStartIndex[1] + 1;
+  int ks = GridStartIndex[2] + 1;
+  int ie = GridEndIndex[0] + 1;
+  int je = GridEndIndex[1] + 1;
+  int ke = GridEndIndex[2] + 1;
+
+  // The sweeps' local arrays have MAX_ANY_SINGLE_DIRECTION elements,
+  // as checked in ppm_de.F
+
+  ASSERT4 ("EnzoBlock::SolvePPMSweeps()",
+	   "Block dimensions (%d %d %d) exceed MAX_ANY_SINGLE_DIRECTION %d",
+	   in,jn,kn,MAX_ANY_SINGLE_DIRECTION,
+	   MAX(MAX(in,jn),kn) <= (MAX_ANY_SINGLE_DIRECTION));
+
+  const int ms = MAX(MAX(in*jn, jn*kn), kn*in);
+
+  enzo_float gamma = Gamma;
+  enzo_float eta1  = DualEnergyFormalismEta1;
+  enzo_float eta2  = DualEnergyFormalismEta2;
+  enzo_float pmin  = tiny;
+
+  // Subgrid fluxes (the flux registers when nsubgrids is 1) are
+  // stored by each slice for its own rows of the face, so slices
+  // still write disjoint data
+
+  int num_threads = MAX(1,PPMSweepThreads);
+#ifndef CONFIG_USE_OPENMP
+  num_threads = 1;
+#endif
+
+  // Each thread gets its own copy of the 30 slice temporaries plus
+  // the four colour slices used by the sweeps
+
+  const int size_temp = ms*(30+4*ncolour);
+  enzo_float * temp = hydro_temp_(num_threads*size_temp);
+
+  // calcdiss() reads v and w up to two slices away, so when diffusion
+  // or flattening is enabled slices are swept in three interleaved
+  // phases (slice mod 3) to avoid reading a slice while it is being
+  // updated.  Results then differ from the serial ppm_de() ordering,
+  // but are independent of the number of threads.
+
+  const int num_phases =
+    (PPMDiffusionParameter || PPMFlatteningParameter) ? 3 : 1;
+
+  const int nxz = ie - is + 1;
+  const int nyz = je - js + 1;
+  const int nzz = ke - ks + 1;
+
+  // Loop over directions, using a Strang-type splitting
+
+  const int ixyz = cycle_ % rank;
+
+  for (int n = ixyz; n <= ixyz + rank - 1; n++) {
+
+    const int axis = n % rank;
+
+    if ((axis == 0 && nxz <= 1) ||
+	(axis == 1 && nyz <= 1) ||
+	(axis == 2 && nzz <= 1)) continue;
+
+    // x sweeps loop over k, y sweeps over i, and z sweeps over j
+
+    const int num_slices = (axis == 0) ? kn : ((axis == 1) ? in : jn);
+
+    for (int phase = 0; phase < num_phases; phase++) {
+
+#ifdef CONFIG_USE_OPENMP
+#pragma omp parallel for num_threads(num_threads) schedule(static)
+#endif
+      for (int slice = phase+1; slice <= num_slices; slice += num_phases) {
+
+#ifdef CONFIG_USE_OPENMP
+	enzo_float * t = temp + omp_get_thread_num()*size_temp;
+#else
+	enzo_float * t = temp;
+#endif
+	int index_slice = slice;
+
+	if (axis == 0) {
+	  FORTRAN_NAME(xeuler_sweep)
+	    (&index_slice, EULER_SWEEP_ARGS(gr_ax,t));
+	} else if (axis == 1) {
+	  FORTRAN_NAME(yeuler_sweep)
+	    (&index_slice, EULER_SWEEP_ARGS(gr_ay,t));
+	} else {
+	  FORTRAN_NAME(zeuler_sweep)
+	    (&index_slice, EULER_SWEEP_ARGS(gr_az,t));
+	}
+      }
+    }
+  }
+}
+
+#undef EULER_SWEEP_ARGS
@@ -77,6 +77,78 @@ extern "C" void FORTRAN_NAME(ppm_de)
    int *ncolour, enzo_float *colourpt, int *coloff,
    int colindex[]);
 
+extern "C" void FORTRAN_NAME(xeuler_sweep)
+  (int *k, enzo_float *d, enzo_float *e, enzo_float *u, enzo_float *v,
+   enzo_float *w, enzo_float *ge, int *in, int *jn, int *kn,
+   int *gravity, enzo_float *gr_acc, int *idual,
+   enzo_float *eta1, enzo_float *eta2,
+   int *is, int *ie, int *js, int *je, int *ks, int *ke,
+   enzo_float *gamma, enzo_float *pmin, enzo_float *dt,
+   enzo_float *dx, enzo_float *dy, enzo_float *dz,
+   int *idiff, int *iflatten, int *isteepen, int *ipresfree,
+   int *nsubgrids, int lface[], int rface[],
+   int fistart[], int fiend[], int fjstart[], int fjend[],
+   int dindex[], int eindex[], int geindex[],
+   int uindex[], int vindex[], int windex[], enzo_float *array,
+   int *ncolor, enzo_float *colorpt, int *coloff, int colindex[],
+   enzo_float *dls, enzo_float *drs, enzo_float *flatten, enzo_float *pbar,
+   enzo_float *pls, enzo_float *prs, enzo_float *pslice, enzo_float *ubar,
+   enzo_float *uls, enzo_float *urs, enzo_float *vls, enzo_float *vrs,
+   enzo_float *gels, enzo_float *gers,
+   enzo_float *wls, enzo_float *wrs, enzo_float *diffcoef, enzo_float *dslice,
+   enzo_float *eslice, enzo_float *uslice, enzo_float *vslice, enzo_float *wslice,
+   enzo_float *df, enzo_float *ef, enzo_float *uf, enzo_float *vf,
+   enzo_float *wf, enzo_float *grslice, enzo_float *geslice, enzo_float *gef,
+   enzo_float *colslice, enzo_float *colf, enzo_float *colls, enzo_float *colrs);
+
+extern "C" void FORTRAN_NAME(yeuler_sweep)
+  (int *i, enzo_float *d, enzo_float *e, enzo_float *u, enzo_float *v,
+   enzo_float *w, enzo_float *ge, int *in, int *jn, int *kn,
+   int *gravity, enzo_float *gr_acc, int *idual,
+   enzo_float *eta1, enzo_float *eta2,
+   int *is, int *ie, int *js, int *je, int *ks, int *ke,
+   enzo_float *gamma, enzo_float *pmin, enzo_float *dt,
+   enzo_float *dx, enzo_float *dy, enzo_float *dz,
+   int *idiff, int *iflatten, int *isteepen, int *ipresfree,
+   int *nsubgrids, int lface[], int rface[],
+   int fistart[], int fiend[], int fjstart[], int fjend[],
+   int dindex[], int eindex[], int geindex[],
+   int uindex[], int vindex[], int windex[], enzo_float *array,
+   int *ncolor, enzo_float *colorpt, int *coloff, int colindex[],
+   enzo_float *dls, enzo_float *drs, enzo_float *flatten, enzo_float *pbar,
+   enzo_float *pls, enzo_float *prs, enzo_float *pslice, enzo_float *ubar,
+   enzo_float *uls, enzo_float *urs, enzo_float *vls, enzo_float *vrs,
+   enzo_float *gels, enzo_float *gers,
+   enzo_float *wls, enzo_float *wrs, enzo_float *diffcoef, enzo_float *dslice,
+   enzo_float *eslice, enzo_float *uslice, enzo_float *vslice, enzo_float *wslice,
+   enzo_float *df, enzo_float *ef, enzo_float *uf, enzo_float *vf,
+   enzo_float *wf, enzo_float *grslice, enzo_float *geslice, enzo_float *gef,
+   enzo_float *colslice, enzo_float *colf, enzo_float *colls, enzo_float *colrs);
+
+extern "C" void FORTRAN_NAME(zeuler_sweep)
+  (int *j, enzo_float *d, enzo_float *e, enzo_float *u, enzo_float *v,
+   enzo_float *w, enzo_float *ge, int *in, int *jn, int *kn,
+   int *gravity, enzo_float *gr_acc, int *idual,
+   enzo_float *eta1, enzo_float *eta2,
+   int *is, int *ie, int *js, int *je, int *ks, int *ke,
+   enzo_float *gamma, enzo_float *pmin, enzo_float *dt,
+   enzo_float *dx, enzo_float *dy, enzo_float *dz,
+   int *idiff, int *iflatten, int *isteepen, int *ipresfree,
+   int *nsubgrids, int lface[], int rface[],
+   int fistart[], int fiend[], int fjstart[], int fjend[],
+   int dindex[], int eindex[], int geindex[],
+   int uindex[], int vindex[], int windex[], enzo_float *array,
+   int *ncolor, enzo_float *colorpt, int *coloff, int colindex[],
+   enzo_float *dls, enzo_float *drs, enzo_float *flatten, enzo_float *pbar,
+   enzo_float *pls, enzo_float *prs, enzo_float *pslice, enzo_float *ubar,
+   enzo_float *uls, enzo_float *urs, enzo_float *vls, enzo_float *vrs,
+   enzo_float *gels, enzo_float *gers,
+   enzo_float *wls, enzo_float *wrs, enzo_float *diffcoef, enzo_float *dslice,
+   enzo_float *eslice, enzo_float *uslice, enzo_float *vslice, enzo_float *wslice,
+   enzo_float *df, enzo_float *ef, enzo_float *uf, enzo_float *vf,
+   enzo_float *wf, enzo_float *grslice, enzo_float *geslice, enzo_float *gef,
+   enzo_float *colslice, enzo_float *colf, enzo_float *colls, enzo_float *colrs);
+
 extern "C" void FORTRAN_NAME(ppml)
   (enzo_float *dn,   enzo_float *vx,   enzo_float *vy,   enzo_float *vz,
    enzo_float *bx,   enzo_float *by,   enzo_float *bz,
@@ -0,0 +1,45 @@
+#!/usr/bin/python
+
+# Merge per-process trace files written with Performance:trace:name
+# into a single Chrome trace file (view with chrome://tracing or
+# https://ui.perfetto.dev)
+#
+# usage: trace-merge.py <output.json> <trace-file> [<trace-file> ...]
+
+import sys
+import json
+
+def read_trace(file_name):
+    # Per-process files are JSON arrays that may be missing the
+    # closing bracket and end with a trailing comma
+    text = open(file_name).read().strip()
+    if text.endswith(']'):
+        text = text[:-1].rstrip()
+    if text.endswith(','):
+        text = text[:-1]
+    return json.loads(text + ']')
+
+if len(sys.argv) < 3:
+    print ("usage: %s <output.json> <trace-file> [<trace-file> ...]" % sys.argv[0])
+    sys.exit(1)
+
+events = []
+for file_name in sys.argv[2:]:
+    events = events + read_trace(file_name)
+
+# Shift times to start at zero and order events by time
+
+timed = [e for e in events if 'ts' in e]
+if timed:
+    time_start = min([e['ts'] for e in timed])
+    for e in timed:
+        e['ts'] = e['ts'] - time_start
+
+events.sort(key=lambda e: (e['ph'] != 'M', e.get('ts',0)))
+
+out = open(sys.argv[1],'w')
+json.dump({'traceEvents' : events, 'displayTimeUnit' : 'ms'}, out)
+out.close()
+
+print ("Wrote %d events from %d files to %s" %
+       (len(events), len(sys.argv) - 2, sys.argv[1]))